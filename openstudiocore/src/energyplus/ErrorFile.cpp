@@ -28,19 +28,205 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <cstring>
+#include <limits>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // size of the blocks read from the err file
+    const std::streamsize c_readBufferSize = 1 << 16;
+
+    // maximum number of message classes kept, further classes are counted together per level
+    const size_t c_maxMessageSummaries = 1000;
+
+    inline bool isSpace(char c)
+    {
+      return (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v');
+    }
+
+    inline bool startsWith(const char* begin, const char* end, const char* prefix)
+    {
+      for (; *prefix; ++prefix, ++begin){
+        if ((begin == end) || (*begin != *prefix)){
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // matches "\*\*\s*([^\s\*]+)\s*\*\*(.*)" at begin
+    bool matchMarkerBody(const char* begin, const char* end, std::string& type, const char*& rest)
+    {
+      const char* p = begin;
+      if (!startsWith(p, end, "**")){
+        return false;
+      }
+      p += 2;
+      while ((p != end) && isSpace(*p)){
+        ++p;
+      }
+      const char* typeBegin = p;
+      while ((p != end) && !isSpace(*p) && (*p != '*')){
+        ++p;
+      }
+      const char* typeEnd = p;
+      if (typeBegin == typeEnd){
+        return false;
+      }
+      while ((p != end) && isSpace(*p)){
+        ++p;
+      }
+      if (!startsWith(p, end, "**")){
+        return false;
+      }
+      type.assign(typeBegin, typeEnd);
+      rest = p + 2;
+      return true;
+    }
+
+    // equivalent to the regex "^\s*\**\s+\*\*\s*([^\s\*]+)\s*\*\*(.*)$"
+    // type is "~~~" for continuation lines of a multi line warning or error
+    bool matchMarker(const char* begin, const char* end, std::string& type, const char*& rest)
+    {
+      const char* p = begin;
+      while ((p != end) && isSpace(*p)){
+        ++p;
+      }
+
+      // no leading stars, at least one whitespace before the marker
+      if ((p != begin) && matchMarkerBody(p, end, type, rest)){
+        return true;
+      }
+
+      // leading stars followed by at least one whitespace before the marker
+      const char* q = p;
+      while ((q != end) && (*q == '*')){
+        ++q;
+      }
+      if (q == p){
+        return false;
+      }
+      const char* r = q;
+      while ((r != end) && isSpace(*r)){
+        ++r;
+      }
+      if (r == q){
+        return false;
+      }
+      return matchMarkerBody(r, end, type, rest);
+    }
+
+    // returns pointer past "^\s*\*+ " or nullptr if there is no such prefix
+    const char* skipStarPrefix(const char* begin, const char* end)
+    {
+      const char* p = begin;
+      while ((p != end) && isSpace(*p)){
+        ++p;
+      }
+      const char* q = p;
+      while ((q != end) && (*q == '*')){
+        ++q;
+      }
+      if ((q == p) || (q == end) || (*q != ' ')){
+        return nullptr;
+      }
+      return q + 1;
+    }
+
+    // matches "^\s*\*+ EnergyPlus Completed Successfully.*" or "^\s*\*+ GroundTempCalc\S* Completed Successfully.*"
+    bool matchCompletedSuccessfully(const char* begin, const char* end)
+    {
+      const char* p = skipStarPrefix(begin, end);
+      if (!p){
+        return false;
+      }
+      if (startsWith(p, end, "EnergyPlus Completed Successfully")){
+        return true;
+      }
+      if (startsWith(p, end, "GroundTempCalc")){
+        p += 14;
+        while ((p != end) && !isSpace(*p)){
+          ++p;
+        }
+        return startsWith(p, end, " Completed Successfully");
+      }
+      return false;
+    }
+
+    // matches "^\s*\*+ EnergyPlus Terminated.*"
+    bool matchCompletedUnsuccessfully(const char* begin, const char* end)
+    {
+      const char* p = skipStarPrefix(begin, end);
+      return (p && startsWith(p, end, "EnergyPlus Terminated"));
+    }
+
+    // key used to group repeated messages, numeric values are replaced so messages differing
+    // only in reported values or object numbers fall into the same class
+    std::string summaryKey(int level, const std::string& message)
+    {
+      std::string result;
+      result.reserve(message.size() + 2);
+      result.push_back(static_cast<char>('0' + level));
+      result.push_back(':');
+      bool inNumber = false;
+      for (char c : message){
+        if (c >= '0' && c <= '9'){
+          if (!inNumber){
+            result.push_back('#');
+            inNumber = true;
+          }
+        }else{
+          result.push_back(c);
+          inNumber = false;
+        }
+      }
+      return result;
+    }
+
+  }
+
+  ErrorMessageSummary::ErrorMessageSummary(const ErrorLevel& level, const std::string& message, unsigned count)
+    : m_level(level), m_message(message), m_count(count)
+  {}
+
+  ErrorLevel ErrorMessageSummary::level() const
+  {
+    return m_level;
+  }
+
+  std::string ErrorMessageSummary::message() const
+  {
+    return m_message;
+  }
+
+  unsigned ErrorMessageSummary::count() const
+  {
+    return m_count;
+  }
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_path(errPath), m_offset(0), m_maxStoredMessages(std::numeric_limits<unsigned>::max()), m_lastStoredLevel(-1),
+      m_numWarnings(0), m_numSevereErrors(0), m_numFatalErrors(0), m_completed(false), m_completedSuccessfully(false)
+  {
+    parse(true);
+  }
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, unsigned maxStoredMessages)
+    : m_path(errPath), m_offset(0), m_maxStoredMessages(maxStoredMessages), m_lastStoredLevel(-1),
+      m_numWarnings(0), m_numSevereErrors(0), m_numFatalErrors(0), m_completed(false), m_completedSuccessfully(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    parse(true);
+  }
+
+  bool ErrorFile::update()
+  {
+    return parse(false);
   }
 
   /// get warnings
@@ -61,6 +247,25 @@ namespace energyplus {
     return m_fatalErrors;
   }
 
+  unsigned ErrorFile::numWarnings() const
+  {
+    return m_numWarnings;
+  }
+
+  unsigned ErrorFile::numSevereErrors() const
+  {
+    return m_numSevereErrors;
+  }
+
+  unsigned ErrorFile::numFatalErrors() const
+  {
+    return m_numFatalErrors;
+  }
+
+  std::vector<ErrorMessageSummary> ErrorFile::messageSummaries() const
+  {
+    return m_summaries;
+  }
 
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const
@@ -74,94 +279,178 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  bool ErrorFile::parse(bool parsePartialLine)
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
+    if (m_completed){
+      return false;
+    }
 
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
+    openstudio::filesystem::ifstream is(m_path, std::ios_base::in | std::ios_base::binary);
+    if (!is.is_open()){
+      return false;
+    }
+    is.seekg(m_offset);
+    if (!is){
+      return false;
+    }
 
-    // repeat count
+    bool result = false;
+    std::vector<char> buffer(c_readBufferSize);
+    std::string partialLine;
 
+    // read the file in large blocks and scan each complete line in place
+    while (!m_completed && is){
+      is.read(buffer.data(), c_readBufferSize);
+      std::streamsize n = is.gcount();
+      if (n <= 0){
+        break;
+      }
 
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
+      const char* begin = buffer.data();
+      const char* end = begin + n;
+      while (!m_completed && (begin != end)){
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!newline){
+          partialLine.append(begin, end);
+          break;
+        }
 
-      boost::smatch matches;
+        if (partialLine.empty()){
+          parseLine(begin, newline);
+        }else{
+          partialLine.append(begin, newline);
+          parseLine(partialLine.data(), partialLine.data() + partialLine.size());
+          partialLine.clear();
+        }
 
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
+        m_offset += (newline - begin) + 1;
+        begin = newline + 1;
+        result = true;
+      }
+    }
 
+    // a line without a trailing newline may still be being written
+    if (!m_completed && parsePartialLine && !partialLine.empty()){
+      parseLine(partialLine.data(), partialLine.data() + partialLine.size());
+      m_offset += partialLine.size();
+      result = true;
+    }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+    return result;
+  }
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
+  void ErrorFile::parseLine(const char* begin, const char* end)
+  {
+    std::string type;
+    const char* rest = nullptr;
+
+    if (matchMarker(begin, end, type, rest)){
+      if (type == "~~~"){
+        // continuation of a multi line warning or error
+        std::string temp(rest, end);
+        boost::trim_right(temp);
+        switch (m_lastStoredLevel){
+          case ErrorLevel::Warning:
+            m_warnings.back() += "\n" + temp;
             break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
+          case ErrorLevel::Severe:
+            m_severeErrors.back() += "\n" + temp;
+            break;
+          case ErrorLevel::Fatal:
+            m_fatalErrors.back() += "\n" + temp;
+            break;
+          default:
             break;
-          }
         }
+      }else{
+        std::string warningOrErrorString(rest, end);
+        boost::trim(warningOrErrorString);
+        addMessage(type, warningOrErrorString);
+      }
+    }else{
+      // any other line ends a multi line warning or error
+      m_lastStoredLevel = -1;
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
+      if (matchCompletedSuccessfully(begin, end)){
+        m_completed = true;
+        m_completedSuccessfully = true;
+      }else if (matchCompletedUnsuccessfully(begin, end)){
+        m_completed = true;
+        m_completedSuccessfully = false;
+      }
+    }
+  }
 
+  void ErrorFile::addMessage(const std::string& type, const std::string& message)
+  {
+    m_lastStoredLevel = -1;
+
+    int level;
+    if (type == "Warning"){
+      level = ErrorLevel::Warning;
+    }else if (type == "Severe"){
+      level = ErrorLevel::Severe;
+    }else if (type == "Fatal"){
+      level = ErrorLevel::Fatal;
+    }else{
+      try{
+        level = ErrorLevel(type).value();
+      }catch(...){
+        LOG(Error, "Unknown warning or error level '" << type << "'");
+        return;
+      }
+    }
 
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
+    LOG(Trace, "Error parsed: " << message);
+
+    std::string key = summaryKey(level, message);
+    auto it = m_summaryIndex.find(key);
+    if ((it == m_summaryIndex.end()) && (m_summaryIndex.size() >= c_maxMessageSummaries)){
+      // too many distinct messages, e.g. one per object, count the rest under one class per level
+      key = summaryKey(level, "");
+      key.push_back('\0');
+      it = m_summaryIndex.find(key);
+      if (it == m_summaryIndex.end()){
+        m_summaryIndex.insert(std::make_pair(key, static_cast<unsigned>(m_summaries.size())));
+        m_summaries.push_back(ErrorMessageSummary(ErrorLevel(level), "Other " + ErrorLevel(level).valueName() + " messages", 1));
+        it = m_summaryIndex.end();
+      }
+    }else if (it == m_summaryIndex.end()){
+      m_summaryIndex.insert(std::make_pair(key, static_cast<unsigned>(m_summaries.size())));
+      m_summaries.push_back(ErrorMessageSummary(ErrorLevel(level), message, 1));
+    }
+    if (it != m_summaryIndex.end()){
+      ++m_summaries[it->second].m_count;
+    }
 
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+    bool store = ((m_warnings.size() + m_severeErrors.size() + m_fatalErrors.size()) < m_maxStoredMessages);
 
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
+    switch (level){
+      case ErrorLevel::Warning:
+        ++m_numWarnings;
+        if (store){
+          m_warnings.push_back(message);
         }
-
-      }else if (boost::regex_match(line, completedSuccessful) 
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
         break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
-        m_completed = true;
-        m_completedSuccessfully = false;
+      case ErrorLevel::Severe:
+        ++m_numSevereErrors;
+        if (store){
+          m_severeErrors.push_back(message);
+        }
         break;
-      }
+      case ErrorLevel::Fatal:
+        ++m_numFatalErrors;
+        if (store){
+          m_fatalErrors.push_back(message);
+        }
+        break;
+      default:
+        return;
     }
 
+    if (store){
+      m_lastStoredLevel = level;
+    }
   }
 
 } // energyplus
@@ -36,6 +36,7 @@
 #include "../utilities/core/Logger.hpp"
 
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -49,12 +50,47 @@ namespace energyplus {
       ((Severe)) 
       ((Fatal)) );
 
+  /** \class ErrorMessageSummary
+   *  \brief A class of repeated EnergyPlus warnings or errors.  Messages whose first lines differ only
+   *  in numeric values are grouped in the same class. */
+  class ENERGYPLUS_API ErrorMessageSummary {
+   public:
+
+    ErrorMessageSummary(const ErrorLevel& level, const std::string& message, unsigned count);
+
+    /// level of the messages in this class
+    ErrorLevel level() const;
+
+    /// first line of the first message reported in this class
+    std::string message() const;
+
+    /// number of messages reported in this class
+    unsigned count() const;
+
+   private:
+
+    friend class ErrorFile;
+
+    ErrorLevel m_level;
+    std::string m_message;
+    unsigned m_count;
+  };
+
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, parses the entire file
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor, at most maxStoredMessages complete messages are kept in memory,
+    /// messages beyond that limit are only counted in messageSummaries
+    ErrorFile(const openstudio::path& errPath, unsigned maxStoredMessages);
+
+    /// parse any complete lines appended to the file since the last parse, may be called repeatedly
+    /// while EnergyPlus is running, returns true if new lines were parsed
+    /// a final line without a trailing newline is only parsed by the constructor
+    bool update();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -64,6 +100,19 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// get the total number of warnings, including those not stored
+    unsigned numWarnings() const;
+
+    /// get the total number of severe errors, including those not stored
+    unsigned numSevereErrors() const;
+
+    /// get the total number of fatal errors, including those not stored
+    unsigned numFatalErrors() const;
+
+    /// get repeated warnings and errors grouped into counted classes, in order of first occurrence
+    /// after 1000 classes, messages not matching an existing class are counted in one class per level
+    std::vector<ErrorMessageSummary> messageSummaries() const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
@@ -74,11 +123,25 @@ namespace energyplus {
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    bool parse(bool parsePartialLine);
+
+    void parseLine(const char* begin, const char* end);
+
+    void addMessage(const std::string& type, const std::string& message);
+
+    openstudio::path m_path;
+    std::streamoff m_offset;
+    unsigned m_maxStoredMessages;
+    int m_lastStoredLevel;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    unsigned m_numWarnings;
+    unsigned m_numSevereErrors;
+    unsigned m_numFatalErrors;
+    std::vector<ErrorMessageSummary> m_summaries;
+    std::map<std::string, unsigned> m_summaryIndex;
     bool m_completed;
     bool m_completedSuccessfully;
 
@@ -61,6 +61,7 @@
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
@@ -84,6 +85,9 @@
 #include <QThread>
 
 #include <sstream>
+#include <algorithm>
+
+#include <boost/algorithm/string.hpp>
 
 using namespace openstudio::model;
 
@@ -108,6 +112,8 @@ ForwardTranslator::ForwardTranslator()
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
+  // translation edits the model (removes orphans, combines spaces, etc), so work on a copy.
+  // field data is shared copy-on-write with the original, only objects that are edited are copied
   Model modelCopy = model.clone(true).cast<Model>();
 
   m_progressBar = progressBar;
@@ -119,6 +125,23 @@ Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* p
   return translateModelPrivate(modelCopy, true);
 }
 
+bool ForwardTranslator::translateModel( const Model & model, std::ostream& os, ProgressBar* progressBar )
+{
+  Model modelCopy = model.clone(true).cast<Model>();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  // objects are added through the same Workspace path as translateModel, so names and pointers match,
+  // and printed one at a time rather than through an intermediate IdfFile
+  os << translateModelPrivate(modelCopy, true);
+
+  return os.good();
+}
+
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 {
   Model modelCopy;
@@ -172,6 +195,23 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
 }
 
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
+{
+  translateModelToIdfObjects(model, fullModelTranslation);
+
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject vo = workspace.versionObject();
+  OS_ASSERT(vo);
+  workspace.removeObject(vo->handle());
+
+  workspace.setFastNaming(true);
+  workspace.addObjects(m_idfObjects);
+  workspace.setFastNaming(false);
+  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+
+  return workspace;
+}
+
+void ForwardTranslator::translateModelToIdfObjects( model::Model & model, bool fullModelTranslation )
 {
   reset();
 
@@ -418,23 +458,27 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   translateConstructions(model);
   translateSchedules(model);
 
+  // object families are translated one after another, not in parallel: translate functions share m_map,
+  // m_idfObjects and the always on/off objects, pull in referenced objects of other families through
+  // translateAndMapModelObject, and read the model through caches that are not thread safe
+
   // get air loops in sorted order
   std::vector<AirLoopHVAC> airLoops = model.getConcreteModelObjects<AirLoopHVAC>();
-  std::sort(airLoops.begin(), airLoops.end(), WorkspaceObjectNameLess());
+  sortByName(airLoops);
   for (AirLoopHVAC airLoop : airLoops){
     translateAndMapModelObject(airLoop);
   }
 
   // get AirConditionerVariableRefrigerantFlow objects in sorted order
   std::vector<AirConditionerVariableRefrigerantFlow> vrfs = model.getConcreteModelObjects<AirConditionerVariableRefrigerantFlow>();
-  std::sort(vrfs.begin(), vrfs.end(), WorkspaceObjectNameLess());
+  sortByName(vrfs);
   for (AirConditionerVariableRefrigerantFlow vrf : vrfs){
     translateAndMapModelObject(vrf);
   }
 
   // get plant loops in sorted order
   std::vector<PlantLoop> plantLoops = model.getConcreteModelObjects<PlantLoop>();
-  std::sort(plantLoops.begin(), plantLoops.end(), WorkspaceObjectNameLess());
+  sortByName(plantLoops);
   for (PlantLoop plantLoop : plantLoops){
     translateAndMapModelObject(plantLoop);
   }
@@ -444,7 +488,7 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
 
     // get objects by type in sorted order
     std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
-    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+    sortByName(objects);
 
     for (const WorkspaceObject& workspaceObject : objects){
       model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
@@ -456,52 +500,80 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     // add output requests
     this->createStandardOutputRequests();
   }
-
-  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
-  OptionalWorkspaceObject vo = workspace.versionObject();
-  OS_ASSERT(vo);
-  workspace.removeObject(vo->handle());
-
-  workspace.setFastNaming(true);
-  workspace.addObjects(m_idfObjects);
-  workspace.setFastNaming(false);
-  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
-
-  return workspace;
 }
 
 // struct for sorting children in forward translator
 struct ChildSorter {
-  ChildSorter(std::vector<IddObjectType>& iddObjectTypes)
-    : m_iddObjectTypes(iddObjectTypes)
-  {}
-
-  // sort first by position in iddObjectTypes and then by name
-  bool operator()(const model::ModelObject& a, const model::ModelObject& b) const
+  ChildSorter(const std::vector<IddObjectType>& iddObjectTypes)
+    : m_notInOrder(iddObjectTypes.size())
   {
-    auto ita = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), a.iddObject().type());
-    auto itb = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), b.iddObject().type());
+    // rank of each type is its first position in iddObjectTypes, indexed by IddObjectType::value()
+    for (unsigned i = 0; i < iddObjectTypes.size(); ++i){
+      unsigned value = static_cast<unsigned>(iddObjectTypes[i].value());
+      if (value >= m_ranks.size()){
+        m_ranks.resize(value + 1, m_notInOrder);
+      }
+      if (m_ranks[value] == m_notInOrder){
+        m_ranks[value] = i;
+      }
+    }
+  }
 
-    if (ita < itb){
-      return true;
-    }else if (ita > itb){
-      return false;
+  unsigned rank(const IddObjectType& type) const
+  {
+    unsigned value = static_cast<unsigned>(type.value());
+    if (value < m_ranks.size()){
+      return m_ranks[value];
     }
+    return m_notInOrder;
+  }
+
+  bool inOrder(const IddObjectType& type) const
+  {
+    return (rank(type) != m_notInOrder);
+  }
 
-    std::string aname;
-    boost::optional<std::string> oaname = a.name();
-    if (oaname){
-      aname = *oaname;
+  // sort first by position in iddObjectTypes and then by name, rank and upper case name
+  // are computed once per object rather than once per comparison
+  void sort(std::vector<model::ModelObject>& objects) const
+  {
+    struct Key {
+      unsigned rank;
+      std::string name;
+      unsigned index;
+    };
+
+    std::vector<Key> keys;
+    keys.reserve(objects.size());
+    for (unsigned i = 0; i < objects.size(); ++i){
+      Key key;
+      key.rank = rank(objects[i].iddObject().type());
+      boost::optional<std::string> name = objects[i].name();
+      if (name){
+        // same result as istringLess
+        key.name = boost::to_upper_copy(*name);
+      }
+      key.index = i;
+      keys.push_back(key);
     }
-    std::string bname;
-    boost::optional<std::string> obname = b.name();
-    if (obname){
-      bname = *obname;
+
+    std::sort(keys.begin(), keys.end(), [](const Key& a, const Key& b) {
+      if (a.rank != b.rank){
+        return a.rank < b.rank;
+      }
+      return std::lexicographical_compare(a.name.begin(), a.name.end(), b.name.begin(), b.name.end());
+    });
+
+    std::vector<model::ModelObject> result;
+    result.reserve(objects.size());
+    for (const Key& key : keys){
+      result.push_back(objects[key.index]);
     }
-    return istringLess(aname, bname);
+    objects.swap(result);
   }
 
-  std::vector<IddObjectType> m_iddObjectTypes;
+  std::vector<unsigned> m_ranks;
+  unsigned m_notInOrder;
 };
 
 boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject & modelObject)
@@ -2939,14 +3011,14 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
   if(opo)
   {
     ModelObjectVector children = opo->children();
-    IddObjectTypeVector types = iddObjectsToTranslate();
+    static const ChildSorter childSorter(iddObjectsToTranslate());
 
     // sort these objects as well
-    std::sort(children.begin(), children.end(), ChildSorter(types));
+    childSorter.sort(children);
 
     for(auto & elem : children)
     {
-      if (std::find(types.begin(),types.end(),elem.iddObject().type()) != types.end()) {
+      if (childSorter.inOrder(elem.iddObject().type())) {
         translateAndMapModelObject(elem);
       }
     }
@@ -3220,7 +3292,7 @@ void ForwardTranslator::translateConstructions(const model::Model & model)
 
     // get objects by type in sorted order
     std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
-    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+    sortByName(objects);
 
     for (const WorkspaceObject& workspaceObject : objects){
       model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
@@ -3244,7 +3316,7 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
 
   // loop over schedule type limits
   std::vector<WorkspaceObject> objects = model.getObjectsByType(IddObjectType::OS_ScheduleTypeLimits);
-  std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+  sortByName(objects);
   for (const WorkspaceObject& workspaceObject : objects){
     model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
     translateAndMapModelObject(modelObject);
@@ -3265,7 +3337,7 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
 
     // get objects by type in sorted order
     objects = model.getObjectsByType(iddObjectType);
-    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+    sortByName(objects);
 
     for (const WorkspaceObject& workspaceObject : objects){
       model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
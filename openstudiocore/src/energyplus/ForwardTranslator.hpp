@@ -402,6 +402,12 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModel( const model::Model & model, ProgressBar* progressBar=nullptr );
 
+  /** Translates the given Model and writes the resulting IDF to os, the same text Workspace::save writes for
+   *  the result of translateModel, without a temporary file or an intermediate IdfFile.
+   *  Returns false if writing fails.
+   */
+  bool translateModel( const model::Model & model, std::ostream& os, ProgressBar* progressBar=nullptr );
+
   /** Translates a ModelObject into a Workspace
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
@@ -451,6 +457,9 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
 
+  /** Does the work of translateModelPrivate, leaving the translated objects in m_idfObjects. */
+  void translateModelToIdfObjects( model::Model& model, bool fullModelTranslation );
+
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
   boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow( model::AirConditionerVariableRefrigerantFlow & modelObject );
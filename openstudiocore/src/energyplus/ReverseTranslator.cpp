@@ -69,6 +69,7 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
   m_workspaceToModelMap.clear();
 
   m_untranslatedIdfObjects.clear();
+  m_untranslatedHandles.clear();
 
   m_logSink.resetStringStream();
 
@@ -136,6 +137,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   m_workspaceToModelMap.clear();
 
   m_untranslatedIdfObjects.clear();
+  m_untranslatedHandles.clear();
 
   m_logSink.resetStringStream();
 
@@ -233,19 +235,6 @@ std::vector<IdfObject> ReverseTranslator::untranslatedIdfObjects() const
   return m_untranslatedIdfObjects;
 }
 
-struct IdfObjectEqual {
-  explicit IdfObjectEqual(const IdfObject& target)
-    : m_target(target)
-  {}
-
-  bool operator()(const IdfObject& other) const
-  {
-    return (m_target == other);
-  }
-
-  IdfObject m_target;
-};
-
 boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject)
 {
   auto i = m_workspaceToModelMap.find(workspaceObject.handle());
@@ -986,7 +975,8 @@ boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(c
     m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
   }else{
     if (addToUntranslated){
-      if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject())) == m_untranslatedIdfObjects.end()){
+      // idfObject() returns a new copy each time, so track untranslated objects by handle
+      if (m_untranslatedHandles.insert(workspaceObject.handle()).second){
         LOG(Trace,"Ignoring " << workspaceObject.briefDescription() << ".");
         m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
       }
@@ -34,6 +34,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -332,6 +334,9 @@ class ENERGYPLUS_API ReverseTranslator {
 
   std::vector<IdfObject> m_untranslatedIdfObjects;
 
+  // handles of the workspace objects in m_untranslatedIdfObjects
+  std::set<openstudio::Handle> m_untranslatedHandles;
+
   StringStreamLogSink m_logSink;
 
   ProgressBar* m_progressBar;
@@ -39,6 +39,34 @@
 
 using openstudio::energyplus::ErrorFile;
 
+namespace {
+
+  // error file written by a test in the temp directory, removed when the test finishes
+  struct TemporaryErrorFile
+  {
+    explicit TemporaryErrorFile(const std::string& name)
+      : path(openstudio::tempDir() / openstudio::toPath(name))
+    {
+      remove();
+    }
+
+    ~TemporaryErrorFile()
+    {
+      remove();
+    }
+
+    void remove()
+    {
+      if (openstudio::filesystem::exists(path)){
+        openstudio::filesystem::remove(path);
+      }
+    }
+
+    openstudio::path path;
+  };
+
+}
+
 TEST_F(EnergyPlusFixture,ErrorFile_NoErrorsNoWarnings)
 {
   openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/NoErrorsNoWarnings.err");
@@ -114,3 +142,130 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
 }
 
 
+TEST_F(EnergyPlusFixture,ErrorFile_RepeatingWarnings)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  EXPECT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_EQ(52u, errorFile.numWarnings());
+  EXPECT_EQ(0u, errorFile.numSevereErrors());
+  EXPECT_EQ(0u, errorFile.numFatalErrors());
+  EXPECT_EQ("SimHVAC: Exceeding Maximum iterations for all HVAC loops, during RUN PERIOD 1 continues\n   This error occurred 15 total times;\n   during Warmup 0 times;\n   during Sizing 0 times.", 
+            errorFile.warnings()[51]);
+
+  std::vector<openstudio::energyplus::ErrorMessageSummary> summaries = errorFile.messageSummaries();
+  ASSERT_EQ(static_cast<unsigned>(13), summaries.size());
+  EXPECT_EQ("IP: Note -- Some missing fields have been filled with defaults. See the audit output file for details.", summaries[0].message());
+  EXPECT_EQ(1u, summaries[0].count());
+  EXPECT_EQ("CalcDoe2DXCoil: Coil:Cooling:DX:SingleSpeed \"COIL COOLING DX SINGLE SPEED 3\" - Air-cooled condenser inlet dry-bulb temperature below 0 C. Outdoor dry-bulb temperature = -3.80", 
+            summaries[5].message());
+  EXPECT_EQ(4u, summaries[5].count());
+  EXPECT_EQ(openstudio::energyplus::ErrorLevel::Warning, summaries[5].level().value());
+  EXPECT_EQ(11u, summaries[6].count());
+
+  unsigned total = 0;
+  for (const auto& summary : summaries){
+    total += summary.count();
+  }
+  EXPECT_EQ(52u, total);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_MaxStoredMessages)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+
+  ErrorFile errorFile(path, 10);
+  EXPECT_EQ(static_cast<unsigned>(10), errorFile.warnings().size() + errorFile.severeErrors().size() + errorFile.fatalErrors().size());
+  EXPECT_EQ(46u, errorFile.numWarnings());
+  EXPECT_EQ(8u, errorFile.numSevereErrors());
+  EXPECT_EQ(1u, errorFile.numFatalErrors());
+
+  unsigned total = 0;
+  for (const auto& summary : errorFile.messageSummaries()){
+    total += summary.count();
+  }
+  EXPECT_EQ(55u, total);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_Update)
+{
+  TemporaryErrorFile errFile("ErrorFile_Update.err");
+  const openstudio::path& path = errFile.path;
+
+  {
+    openstudio::filesystem::ofstream os(path);
+    os << "Program Version,EnergyPlus, Version 8.7.0" << std::endl;
+    os << "   ** Warning ** First warning" << std::endl;
+    os << "   **   ~~~   ** first continuation" << std::endl;
+  }
+
+  ErrorFile errorFile(path);
+  ASSERT_EQ(static_cast<unsigned>(1), errorFile.warnings().size());
+  EXPECT_EQ("First warning\n first continuation", errorFile.warnings()[0]);
+  EXPECT_FALSE(errorFile.completed());
+  EXPECT_FALSE(errorFile.update());
+
+  {
+    openstudio::filesystem::ofstream os(path, std::ios_base::app);
+    os << "   **   ~~~   ** second continuation" << std::endl;
+    os << "   ** Severe  ** First severe error" << std::endl;
+    os << "   ** Severe  ** Second";
+  }
+
+  EXPECT_TRUE(errorFile.update());
+  ASSERT_EQ(static_cast<unsigned>(1), errorFile.warnings().size());
+  EXPECT_EQ("First warning\n first continuation\n second continuation", errorFile.warnings()[0]);
+  ASSERT_EQ(static_cast<unsigned>(1), errorFile.severeErrors().size());
+  EXPECT_FALSE(errorFile.completed());
+
+  {
+    openstudio::filesystem::ofstream os(path, std::ios_base::app);
+    os << " severe error" << std::endl;
+    os << "   ************* EnergyPlus Completed Successfully-- 1 Warning; 2 Severe Errors; Elapsed Time=00hr 00min  1.00sec" << std::endl;
+  }
+
+  EXPECT_TRUE(errorFile.update());
+  ASSERT_EQ(static_cast<unsigned>(2), errorFile.severeErrors().size());
+  EXPECT_EQ("Second severe error", errorFile.severeErrors()[1]);
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+  EXPECT_FALSE(errorFile.update());
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_MaxMessageSummaries)
+{
+  TemporaryErrorFile errFile("ErrorFile_MaxMessageSummaries.err");
+  const openstudio::path& path = errFile.path;
+
+  {
+    // messages naming a different object each, letters are used since numbers are grouped
+    openstudio::filesystem::ofstream os(path);
+    os << "Program Version,EnergyPlus, Version 8.7.0" << std::endl;
+    for (unsigned i = 0; i < 1500; ++i){
+      std::string name;
+      for (unsigned n = i; name.size() < 3; n /= 26){
+        name.push_back(static_cast<char>('A' + n % 26));
+      }
+      os << "   ** Warning ** Object " << name << " is not used" << std::endl;
+    }
+    os << "   ** Severe  ** Last severe error" << std::endl;
+    os << "   ************* EnergyPlus Completed Successfully-- 1500 Warning; 1 Severe Errors; Elapsed Time=00hr 00min  1.00sec" << std::endl;
+  }
+
+  ErrorFile errorFile(path);
+  EXPECT_EQ(1500u, errorFile.numWarnings());
+  EXPECT_EQ(1u, errorFile.numSevereErrors());
+
+  std::vector<openstudio::energyplus::ErrorMessageSummary> summaries = errorFile.messageSummaries();
+  ASSERT_EQ(1002u, summaries.size());
+  EXPECT_EQ("Object AAA is not used", summaries[0].message());
+  EXPECT_EQ(openstudio::energyplus::ErrorLevel::Warning, summaries[1000].level().value());
+  EXPECT_EQ(500u, summaries[1000].count());
+  EXPECT_EQ(openstudio::energyplus::ErrorLevel::Severe, summaries[1001].level().value());
+  EXPECT_EQ(1u, summaries[1001].count());
+}
@@ -67,6 +67,8 @@
 #include "../../model/OutputVariable_Impl.hpp"
 #include "../../model/Version.hpp"
 #include "../../model/Version_Impl.hpp"
+#include "../../model/ScheduleTypeLimits.hpp"
+#include "../../model/ScheduleTypeLimits_Impl.hpp"
 #include "../../model/ZoneCapacitanceMultiplierResearchSpecial.hpp"
 #include "../../model/ZoneCapacitanceMultiplierResearchSpecial_Impl.hpp"
 
@@ -93,6 +95,7 @@
 #include <sstream>
 
 #include <vector>
+#include <algorithm>
 
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
@@ -748,3 +751,120 @@ TEST_F(EnergyPlusFixture, BadVariableName)
     EXPECT_TRUE(s == "Good Name" || s == "Bad, !Name") << s;
   }
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_SourceModelUnchanged) {
+  Model model = exampleModel();
+
+  // translation removes spaces without a thermal zone and combines spaces, but only in its copy
+  Space orphanSpace(model);
+  ThermalZone zone = model.getConcreteModelObjects<ThermalZone>()[0];
+  Space secondSpace(model);
+  secondSpace.setThermalZone(zone);
+
+  std::stringstream before;
+  before << model;
+  unsigned numObjects = model.numObjects();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  std::stringstream after;
+  after << model;
+  EXPECT_EQ(numObjects, model.numObjects());
+  EXPECT_EQ(before.str(), after.str());
+  EXPECT_FALSE(orphanSpace.handle().isNull());
+  EXPECT_FALSE(orphanSpace.thermalZone());
+  EXPECT_EQ(2u, zone.spaces().size());
+}
+
+namespace {
+
+  std::vector<std::string> sortedObjectText(const std::vector<IdfObject>& objects) {
+    std::vector<std::string> result;
+    for (const IdfObject& object : objects) {
+      std::stringstream ss;
+      ss << object;
+      result.push_back(ss.str());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  std::vector<std::string> sortedObjectText(const Workspace& workspace) {
+    std::vector<IdfObject> objects;
+    for (const WorkspaceObject& object : workspace.objects()) {
+      objects.push_back(object.idfObject());
+    }
+    return sortedObjectText(objects);
+  }
+
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelToStream) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  std::stringstream ss;
+  EXPECT_TRUE(forwardTranslator.translateModel(model, ss));
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  Workspace workspace = forwardTranslator.translateModel(model);
+
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ(sortedObjectText(workspace), sortedObjectText(idfFile->objects()));
+
+  // written in IddObjectType order, like Workspace::save
+  std::vector<IdfObject> objects = idfFile->objects();
+  ASSERT_FALSE(objects.empty());
+  for (unsigned i = 1; i < objects.size(); ++i) {
+    EXPECT_FALSE(objects[i].iddObject().type() < objects[i-1].iddObject().type());
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_TranslateModelToStream_NameConflict) {
+  Model model = exampleModel();
+
+  // unsupported unit types are translated to a new limits object named Any Number
+  ScheduleTypeLimits anyNumber(model);
+  EXPECT_TRUE(anyNumber.setName("Any Number"));
+  ScheduleTypeLimits pressure(model);
+  EXPECT_TRUE(pressure.setName("Pressure Limits"));
+  EXPECT_TRUE(pressure.setUnitType("Pressure"));
+
+  ForwardTranslator forwardTranslator;
+  std::stringstream ss;
+  EXPECT_TRUE(forwardTranslator.translateModel(model, ss));
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::vector<IdfObject> workspaceObjects;
+  for (const WorkspaceObject& object : workspace.objects()) {
+    workspaceObjects.push_back(object.idfObject());
+  }
+
+  // one of the conflicting objects is renamed with a generated name, which differs between runs
+  auto splitLimits = [](const std::vector<IdfObject>& objects, std::vector<std::string>& names) {
+    std::vector<IdfObject> result;
+    for (const IdfObject& object : objects) {
+      if (object.iddObject().type() == IddObjectType::ScheduleTypeLimits) {
+        std::string name = object.name().get();
+        names.push_back(toUUID(name).isNull() ? name : "renamed");
+      } else {
+        result.push_back(object);
+      }
+    }
+    std::sort(names.begin(), names.end());
+    return result;
+  };
+
+  std::vector<std::string> streamedNames;
+  std::vector<std::string> workspaceNames;
+  std::vector<IdfObject> streamedObjects = splitLimits(idfFile->objects(), streamedNames);
+  EXPECT_EQ(sortedObjectText(splitLimits(workspaceObjects, workspaceNames)), sortedObjectText(streamedObjects));
+  EXPECT_EQ(workspaceNames, streamedNames);
+  EXPECT_EQ(1, std::count(streamedNames.begin(), streamedNames.end(), "Any Number"));
+  EXPECT_EQ(1, std::count(streamedNames.begin(), streamedNames.end(), "renamed"));
+}
@@ -83,6 +83,7 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <set>
 
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
@@ -156,6 +157,39 @@ TEST_F(EnergyPlusFixture,ReverseTranslator_BestestEx)
   workspace.save( resourcesPath() / toPath("energyplus/BestestEx/in2.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture,ReverseTranslator_UntranslatedObjects)
+{
+  openstudio::path idfPath = resourcesPath() / toPath("energyplus/Daylighting_Office/in.idf");
+  OptionalIdfFile idfFile = IdfFile::load(idfPath, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  Workspace inWorkspace(*idfFile);
+
+  ReverseTranslator reverseTranslator;
+  Model model1 = reverseTranslator.translateWorkspace(inWorkspace);
+  std::vector<IdfObject> untranslated1 = reverseTranslator.untranslatedIdfObjects();
+  EXPECT_FALSE(untranslated1.empty());
+
+  // each untranslated object is reported once
+  std::set<Handle> handles;
+  for (const IdfObject& object : untranslated1) {
+    EXPECT_TRUE(handles.insert(object.handle()).second) << object.briefDescription();
+  }
+
+  // translating again gives the same result
+  Model model2 = reverseTranslator.translateWorkspace(inWorkspace);
+  std::vector<IdfObject> untranslated2 = reverseTranslator.untranslatedIdfObjects();
+  EXPECT_EQ(model1.numObjects(), model2.numObjects());
+
+  std::multiset<std::string> descriptions1, descriptions2;
+  for (const IdfObject& object : untranslated1) {
+    descriptions1.insert(object.briefDescription());
+  }
+  for (const IdfObject& object : untranslated2) {
+    descriptions2.insert(object.briefDescription());
+  }
+  EXPECT_TRUE(descriptions1 == descriptions2);
+}
+
 TEST_F(EnergyPlusFixture,ReverseTranslator_SimpleRelativeTest)
 {
   openstudio::path idfPath = resourcesPath() / toPath("energyplus/SimpleSurfaces/SimpleSurfaces_Relative.idf");
@@ -88,6 +88,121 @@
 namespace openstudio {
 namespace gbxml {
 
+  namespace {
+
+    typedef std::vector<std::pair<QString, QString> > AttributeVector;
+
+    // escape the same characters as QDomNode::save, '>' is only escaped after "]]", quotes and
+    // whitespace other than spaces are only escaped in attributes, carriage returns in both
+    QString escapeXml(const QString& value, bool attribute)
+    {
+      QString result;
+      result.reserve(value.size());
+      for (int i = 0; i < value.size(); ++i){
+        const QChar c = value.at(i);
+        if (c == '<'){
+          result += "&lt;";
+        } else if (c == '>' && i >= 2 && value.at(i - 1) == ']' && value.at(i - 2) == ']'){
+          result += "&gt;";
+        } else if (c == '&'){
+          result += "&amp;";
+        } else if (attribute && c == '"'){
+          result += "&quot;";
+        } else if (attribute && c == '\n'){
+          result += "&#xa;";
+        } else if (c == '\r'){
+          result += "&#xd;";
+        } else if (attribute && c == '\t'){
+          result += "&#x9;";
+        } else{
+          result += c;
+        }
+      }
+      return result;
+    }
+
+    void writeString(std::ostream& os, const QString& value)
+    {
+      QByteArray bytes = value.toUtf8();
+      os.write(bytes.constData(), bytes.size());
+    }
+
+    void writeIndent(std::ostream& os, int depth)
+    {
+      os << std::string(2 * depth, ' ');
+    }
+
+    void writeAttribute(std::ostream& os, const QString& name, const QString& value)
+    {
+      os << ' ';
+      writeString(os, name);
+      os << "=\"";
+      writeString(os, escapeXml(value, true));
+      os << '"';
+    }
+
+    void writeStartElement(std::ostream& os, int depth, const QString& tagName, const AttributeVector& attributes)
+    {
+      writeIndent(os, depth);
+      os << '<';
+      writeString(os, tagName);
+      for (const auto& attribute : attributes){
+        writeAttribute(os, attribute.first, attribute.second);
+      }
+      os << ">\n";
+    }
+
+    void writeEndElement(std::ostream& os, int depth, const QString& tagName)
+    {
+      writeIndent(os, depth);
+      os << "</";
+      writeString(os, tagName);
+      os << ">\n";
+    }
+
+    // write element and its children, formatted like QDomDocument::toString(2)
+    void writeElement(std::ostream& os, int depth, const QDomElement& element)
+    {
+      writeIndent(os, depth);
+      os << '<';
+      writeString(os, element.tagName());
+
+      QDomNamedNodeMap attributes = element.attributes();
+      for (int i = 0; i < attributes.count(); ++i){
+        QDomAttr attribute = attributes.item(i).toAttr();
+        writeAttribute(os, attribute.name(), attribute.value());
+      }
+
+      if (!element.hasChildNodes()){
+        os << "/>\n";
+        return;
+      }
+
+      QDomNode firstChild = element.firstChild();
+      if (firstChild.isText() && firstChild.nextSibling().isNull()){
+        os << '>';
+        writeString(os, escapeXml(firstChild.toText().data(), false));
+        os << "</";
+        writeString(os, element.tagName());
+        os << ">\n";
+        return;
+      }
+
+      os << ">\n";
+      for (QDomNode child = firstChild; !child.isNull(); child = child.nextSibling()){
+        if (child.isElement()){
+          writeElement(os, depth + 1, child.toElement());
+        } else if (child.isText()){
+          writeIndent(os, depth + 1);
+          writeString(os, escapeXml(child.toText().data(), false));
+          os << '\n';
+        }
+      }
+      writeEndElement(os, depth, element.tagName());
+    }
+
+  } // anonymous namespace
+
   ForwardTranslator::ForwardTranslator()
   {
     m_logSink.setLogLevel(Warn);
@@ -100,6 +215,19 @@ namespace gbxml {
   }
 
   bool ForwardTranslator::modelToGbXML(const openstudio::model::Model& model, const openstudio::path& path, ProgressBar* progressBar)
+  {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary);
+    if (!file.is_open()){
+      return false;
+    }
+
+    bool result = modelToGbXML(model, file, progressBar);
+    file.close();
+
+    return result;
+  }
+
+  bool ForwardTranslator::modelToGbXML(const openstudio::model::Model& model, std::ostream& os, ProgressBar* progressBar)
   {
     m_progressBar = progressBar;
 
@@ -107,19 +235,10 @@ namespace gbxml {
 
     m_logSink.resetStringStream();
 
-    boost::optional<QDomDocument> doc = this->translateModel(model);
-    if (!doc){
-      return false;
-    }
-
-    openstudio::filesystem::ofstream file(path, std::ios_base::binary);
-    if (file.is_open()){
-      openstudio::filesystem::write(file, doc->toString(2));
-      file.close();
-      return true;
-    }
+    m_translatedObjects.clear();
+    m_materials.clear();
 
-    return false;
+    return this->translateModel(model, os);
   }
 
   std::vector<LogMessage> ForwardTranslator::warnings() const
@@ -172,32 +291,30 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<QDomDocument> ForwardTranslator::translateModel(const openstudio::model::Model& model)
+  bool ForwardTranslator::translateModel(const openstudio::model::Model& model, std::ostream& os)
   {
+    // elements are created in doc but never appended to it, each top level element is
+    // written to os as soon as it is complete and then released
     QDomDocument doc;
-    doc.createProcessingInstruction("xml", "version=\"1.0\" encoding=\"utf-8\"");
-
-    QDomElement gbXMLElement = doc.createElement("gbXML");
-    doc.appendChild(gbXMLElement);
-    gbXMLElement.setAttribute("xmlns", "http://www.gbxml.org/schema");
-    gbXMLElement.setAttribute("xmlns:xhtml", "http://www.w3.org/1999/xhtml");
-    gbXMLElement.setAttribute("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
-    gbXMLElement.setAttribute("xmlns:xsd", "http://www.w3.org/2001/XMLSchema");
-    gbXMLElement.setAttribute("xsi:schemaLocation", "http://www.gbxml.org/schema http://gbxml.org/schema/6-01/GreenBuildingXML_Ver6.01.xsd");
-    gbXMLElement.setAttribute("temperatureUnit", "C");
-    gbXMLElement.setAttribute("lengthUnit", "Meters");
-    gbXMLElement.setAttribute("areaUnit", "SquareMeters");
-    gbXMLElement.setAttribute("volumeUnit", "CubicMeters");
-    gbXMLElement.setAttribute("useSIUnitsForResults", "true");
-    gbXMLElement.setAttribute("version", "6.01");
-    gbXMLElement.setAttribute("SurfaceReferenceLocation", "Centerline");
+
+    AttributeVector gbXMLAttributes;
+    gbXMLAttributes.push_back(std::make_pair("xmlns", "http://www.gbxml.org/schema"));
+    gbXMLAttributes.push_back(std::make_pair("xmlns:xhtml", "http://www.w3.org/1999/xhtml"));
+    gbXMLAttributes.push_back(std::make_pair("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"));
+    gbXMLAttributes.push_back(std::make_pair("xmlns:xsd", "http://www.w3.org/2001/XMLSchema"));
+    gbXMLAttributes.push_back(std::make_pair("xsi:schemaLocation", "http://www.gbxml.org/schema http://gbxml.org/schema/6-01/GreenBuildingXML_Ver6.01.xsd"));
+    gbXMLAttributes.push_back(std::make_pair("temperatureUnit", "C"));
+    gbXMLAttributes.push_back(std::make_pair("lengthUnit", "Meters"));
+    gbXMLAttributes.push_back(std::make_pair("areaUnit", "SquareMeters"));
+    gbXMLAttributes.push_back(std::make_pair("volumeUnit", "CubicMeters"));
+    gbXMLAttributes.push_back(std::make_pair("useSIUnitsForResults", "true"));
+    gbXMLAttributes.push_back(std::make_pair("version", "6.01"));
+    gbXMLAttributes.push_back(std::make_pair("SurfaceReferenceLocation", "Centerline"));
+    writeStartElement(os, 0, "gbXML", gbXMLAttributes);
 
     boost::optional<model::Facility> facility = model.getOptionalUniqueModelObject<model::Facility>();
     if (facility){
-      boost::optional<QDomElement> campusElement = translateFacility(*facility, doc);
-      if (campusElement){
-        gbXMLElement.appendChild(*campusElement);
-      }
+      translateFacility(*facility, doc, os, 1);
     }
 
     // do constructions
@@ -220,7 +337,7 @@ namespace gbxml {
     for (const model::ConstructionBase& constructionBase : constructionBases){
       boost::optional<QDomElement> constructionElement = translateConstructionBase(constructionBase, doc);
       if (constructionElement){
-        gbXMLElement.appendChild(*constructionElement);
+        writeElement(os, 1, *constructionElement);
       }
 
       if (m_progressBar){
@@ -239,7 +356,7 @@ namespace gbxml {
     for (const model::Material& material : m_materials){
       boost::optional<QDomElement> layerElement = translateLayer(material, doc);
       if (layerElement){
-        gbXMLElement.appendChild(*layerElement);
+        writeElement(os, 1, *layerElement);
       }
 
       if (m_progressBar){
@@ -249,7 +366,7 @@ namespace gbxml {
     for (const model::Material& material : m_materials){
       boost::optional<QDomElement> materialElement = translateMaterial(material, doc);
       if (materialElement){
-        gbXMLElement.appendChild(*materialElement);
+        writeElement(os, 1, *materialElement);
       }
 
       if (m_progressBar){
@@ -269,7 +386,7 @@ namespace gbxml {
     for (const model::ThermalZone& thermalZone : thermalZones){
       boost::optional<QDomElement> zoneElement = translateThermalZone(thermalZone, doc);
       if (zoneElement){
-        gbXMLElement.appendChild(*zoneElement);
+        writeElement(os, 1, *zoneElement);
       }
 
       if (m_progressBar){
@@ -279,7 +396,6 @@ namespace gbxml {
 
     // Document History
     QDomElement documentHistoryElement = doc.createElement("DocumentHistory");
-    gbXMLElement.appendChild(documentHistoryElement);
 
     QDomElement createdByElement = doc.createElement("CreatedBy");
     documentHistoryElement.appendChild(createdByElement);
@@ -324,6 +440,9 @@ namespace gbxml {
     personInfoElement.appendChild(lastNameElement);
     lastNameElement.appendChild(doc.createTextNode("Unknown"));
 
+    writeElement(os, 1, documentHistoryElement);
+    documentHistoryElement.clear();
+
     // translate results
     boost::optional<SqlFile> sqlFile = model.sqlFile();
     if (sqlFile){
@@ -394,7 +513,6 @@ namespace gbxml {
 
         if (heatLoad){
           QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
           resultsElement.setAttribute("id", thermalZoneId + "HeatLoad");
           resultsElement.setAttribute("resultsType", "HeatLoad");
           resultsElement.setAttribute("unit", "Kilowatt");
@@ -406,11 +524,12 @@ namespace gbxml {
           QDomElement valueElement = doc.createElement("Value");
           resultsElement.appendChild(valueElement);
           valueElement.appendChild(doc.createTextNode(QString::number(*heatLoad/1000.0, 'f')));
+
+          writeElement(os, 1, resultsElement);
         }
 
         if (coolingLoad){
           QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
           resultsElement.setAttribute("id", thermalZoneId + "CoolingLoad");
           resultsElement.setAttribute("resultsType", "CoolingLoad");
           resultsElement.setAttribute("unit", "Kilowatt");
@@ -422,11 +541,12 @@ namespace gbxml {
           QDomElement valueElement = doc.createElement("Value");
           resultsElement.appendChild(valueElement);
           valueElement.appendChild(doc.createTextNode(QString::number(*coolingLoad/1000.0, 'f')));
+
+          writeElement(os, 1, resultsElement);
         }
 
         if (flow){
           QDomElement resultsElement = doc.createElement("Results");
-          gbXMLElement.appendChild(resultsElement);
           resultsElement.setAttribute("id", thermalZoneId + "Flow");
           resultsElement.setAttribute("resultsType", "Flow");
           resultsElement.setAttribute("unit", "CubicMPerHr");
@@ -438,6 +558,8 @@ namespace gbxml {
           QDomElement valueElement = doc.createElement("Value");
           resultsElement.appendChild(valueElement);
           valueElement.appendChild(doc.createTextNode(QString::number(*flow*3600, 'f')));
+
+          writeElement(os, 1, resultsElement);
         }
 
         if (m_progressBar){
@@ -446,27 +568,30 @@ namespace gbxml {
       }
     }
 
-    return doc;
+    writeEndElement(os, 0, "gbXML");
+
+    return os.good();
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc)
+  bool ForwardTranslator::translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc, std::ostream& os, int depth)
   {
-    QDomElement result = doc.createElement("Campus");
-    m_translatedObjects[facility.handle()] = result;
+    m_translatedObjects.insert(facility.handle());
 
     boost::optional<std::string> name = facility.name();
 
     // id
-    result.setAttribute("id", "Facility");
+    AttributeVector attributes;
+    attributes.push_back(std::make_pair("id", "Facility"));
+    writeStartElement(os, depth, "Campus", attributes);
 
     // name
     QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
     if (name){
       nameElement.appendChild(doc.createTextNode(QString::fromStdString(name.get())));
     }else{
       nameElement.appendChild(doc.createTextNode("Facility"));
     }
+    writeElement(os, depth + 1, nameElement);
 
     model::Model model = facility.model();
 
@@ -475,10 +600,7 @@ namespace gbxml {
     // translate building
     boost::optional<model::Building> building = model.getOptionalUniqueModelObject<model::Building>();
     if (building){
-      boost::optional<QDomElement> buildingElement = translateBuilding(*building, doc);
-      if (buildingElement){
-        result.appendChild(*buildingElement);
-      }
+      translateBuilding(*building, doc, os, depth + 1);
     }
 
     // translate surfaces
@@ -493,7 +615,7 @@ namespace gbxml {
     for (const model::Surface& surface : surfaces){
       boost::optional<QDomElement> surfaceElement = translateSurface(surface, doc);
       if (surfaceElement){
-        result.appendChild(*surfaceElement);
+        writeElement(os, depth + 1, *surfaceElement);
       }
 
       if (m_progressBar){
@@ -513,7 +635,7 @@ namespace gbxml {
     for (const model::ShadingSurface& shadingSurface : shadingSurfaces){
       boost::optional<QDomElement> shadingSurfaceElement = translateShadingSurface(shadingSurface, doc);
       if (shadingSurfaceElement){
-        result.appendChild(*shadingSurfaceElement);
+        writeElement(os, depth + 1, *shadingSurfaceElement);
       }
 
       if (m_progressBar){
@@ -521,26 +643,28 @@ namespace gbxml {
       }
     }
 
-    return result;
+    writeEndElement(os, depth, "Campus");
+
+    return true;
   }
 
-  boost::optional<QDomElement> ForwardTranslator::translateBuilding(const openstudio::model::Building& building, QDomDocument& doc)
+  bool ForwardTranslator::translateBuilding(const openstudio::model::Building& building, QDomDocument& doc, std::ostream& os, int depth)
   {
-    QDomElement result = doc.createElement("Building");
-    m_translatedObjects[building.handle()] = result;
+    m_translatedObjects.insert(building.handle());
 
     // id
     std::string name = building.name().get();
-    result.setAttribute("id", escapeName(name));
+    AttributeVector attributes;
+    attributes.push_back(std::make_pair("id", escapeName(name)));
 
     // building type
-    //result.setAttribute("buildingType", "Office");
-    result.setAttribute("buildingType", "Unknown");
+    //attributes.push_back(std::make_pair("buildingType", "Office"));
+    attributes.push_back(std::make_pair("buildingType", "Unknown"));
 
     boost::optional<std::string> standardsBuildingType = building.standardsBuildingType();
     if (standardsBuildingType){
       // todo: map to gbXML types
-      //result.setAttribute("buildingType", escapeName(spaceTypeName));
+      //attributes.push_back(std::make_pair("buildingType", escapeName(spaceTypeName)));
     }
 
     // space type
@@ -548,17 +672,18 @@ namespace gbxml {
     if (spaceType){
       //std::string spaceTypeName = spaceType->name().get();
       // todo: map to gbXML types
-      //result.setAttribute("buildingType", escapeName(spaceTypeName));
+      //attributes.push_back(std::make_pair("buildingType", escapeName(spaceTypeName)));
     }
 
+    writeStartElement(os, depth, "Building", attributes);
+
     // name
     QDomElement nameElement = doc.createElement("Name");
-    result.appendChild(nameElement);
     nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+    writeElement(os, depth + 1, nameElement);
 
     // area
     QDomElement areaElement = doc.createElement("Area");
-    result.appendChild(areaElement);
 
     // DLM: we want to use gbXML's definition of floor area which includes area from all spaces with people in them
     //double floorArea = building.floorArea();
@@ -574,6 +699,7 @@ namespace gbxml {
     }
     
     areaElement.appendChild(doc.createTextNode(QString::number(floorArea, 'f')));
+    writeElement(os, depth + 1, areaElement);
 
     // translate spaces
     if (m_progressBar){
@@ -586,7 +712,7 @@ namespace gbxml {
     for (const model::Space& space : spaces){
       boost::optional<QDomElement> spaceElement = translateSpace(space, doc);
       if (spaceElement){
-        result.appendChild(*spaceElement);
+        writeElement(os, depth + 1, *spaceElement);
       }
 
       if (m_progressBar){
@@ -606,7 +732,7 @@ namespace gbxml {
     for (const model::ShadingSurfaceGroup& shadingSurfaceGroup : shadingSurfaceGroups){
       boost::optional<QDomElement> shadingSurfaceGroupElement = translateShadingSurfaceGroup(shadingSurfaceGroup, doc);
       if (shadingSurfaceGroupElement){
-        result.appendChild(*shadingSurfaceGroupElement);
+        writeElement(os, depth + 1, *shadingSurfaceGroupElement);
       }
 
       if (m_progressBar){
@@ -626,7 +752,7 @@ namespace gbxml {
     for (const model::BuildingStory& story : stories){
       boost::optional<QDomElement> storyElement = translateBuildingStory(story, doc);
       if (storyElement){
-        result.appendChild(*storyElement);
+        writeElement(os, depth + 1, *storyElement);
       }
 
       if (m_progressBar){
@@ -634,13 +760,15 @@ namespace gbxml {
       }
     }
 
-    return result;
+    writeEndElement(os, depth, "Building");
+
+    return true;
   }
 
   boost::optional<QDomElement> ForwardTranslator::translateSpace(const openstudio::model::Space& space, QDomDocument& doc)
   {
     QDomElement result = doc.createElement("Space");
-    m_translatedObjects[space.handle()] = result;
+    m_translatedObjects.insert(space.handle());
 
     // id
     std::string name = space.name().get();
@@ -736,7 +864,7 @@ namespace gbxml {
     }
 
     QDomElement result = doc.createElement("Space");
-    m_translatedObjects[shadingSurfaceGroup.handle()] = result;
+    m_translatedObjects.insert(shadingSurfaceGroup.handle());
 
     // id
     std::string name = shadingSurfaceGroup.name().get();
@@ -775,7 +903,7 @@ namespace gbxml {
     }
     
     QDomElement result = doc.createElement("BuildingStorey");
-    m_translatedObjects[story.handle()] = result;
+    m_translatedObjects.insert(story.handle());
 
     // id
     std::string name = story.name().get();
@@ -802,7 +930,7 @@ namespace gbxml {
     }
 
     QDomElement result = doc.createElement("Surface");
-    m_translatedObjects[surface.handle()] = result;
+    m_translatedObjects.insert(surface.handle());
 
     // id
     std::string name = surface.name().get();
@@ -881,7 +1009,7 @@ namespace gbxml {
         adjacentSpaceIdElement.setAttribute("spaceIdRef", escapeName(adjacentSpaceName));
 
         // count adjacent surface as translated
-        m_translatedObjects[adjacentSurface->handle()] = result;
+        m_translatedObjects.insert(adjacentSurface->handle());
       }
     }
 
@@ -1023,7 +1151,7 @@ namespace gbxml {
     }
 
     QDomElement result = doc.createElement("Opening");
-    m_translatedObjects[subSurface.handle()] = result;
+    m_translatedObjects.insert(subSurface.handle());
 
     // id
     std::string name = subSurface.name().get();
@@ -1179,7 +1307,7 @@ namespace gbxml {
     }
 
     QDomElement result = doc.createElement("Surface");
-    m_translatedObjects[shadingSurface.handle()] = result;
+    m_translatedObjects.insert(shadingSurface.handle());
 
     // id
     std::string name = shadingSurface.name().get();
@@ -1330,7 +1458,7 @@ namespace gbxml {
   boost::optional<QDomElement> ForwardTranslator::translateThermalZone(const openstudio::model::ThermalZone& thermalZone, QDomDocument& doc)
   {
     QDomElement result = doc.createElement("Zone");
-    m_translatedObjects[thermalZone.handle()] = result;
+    m_translatedObjects.insert(thermalZone.handle());
 
     // id
     std::string name = thermalZone.name().get();
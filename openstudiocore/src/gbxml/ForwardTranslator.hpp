@@ -39,6 +39,8 @@
 #include "../model/ModelObject.hpp"
 
 #include <map>
+#include <ostream>
+#include <set>
 
 class QDomDocument;
 class QDomElement;
@@ -77,6 +79,10 @@ namespace gbxml {
 
     bool modelToGbXML(const openstudio::model::Model& model, const openstudio::path& path, ProgressBar* progressBar = nullptr);
 
+    /** Write gbXML for model to os.  Each element is written as soon as it is translated rather than
+     *  building the whole document in memory first. */
+    bool modelToGbXML(const openstudio::model::Model& model, std::ostream& os, ProgressBar* progressBar = nullptr);
+
       /** Get warning messages generated by the last translation. */
     std::vector<LogMessage> warnings() const;
 
@@ -88,9 +94,12 @@ namespace gbxml {
     QString escapeName(const std::string& name);
 
     // listed in translation order
-    boost::optional<QDomDocument> translateModel(const openstudio::model::Model& model);
-    boost::optional<QDomElement> translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc);
-    boost::optional<QDomElement> translateBuilding(const openstudio::model::Building& building, QDomDocument& doc);
+    // these write directly to os, depth is the indentation level of the element
+    bool translateModel(const openstudio::model::Model& model, std::ostream& os);
+    bool translateFacility(const openstudio::model::Facility& facility, QDomDocument& doc, std::ostream& os, int depth);
+    bool translateBuilding(const openstudio::model::Building& building, QDomDocument& doc, std::ostream& os, int depth);
+
+    // these return elements which are written and released by the caller
     boost::optional<QDomElement> translateSpace(const openstudio::model::Space& space, QDomDocument& doc);
     boost::optional<QDomElement> translateShadingSurfaceGroup(const openstudio::model::ShadingSurfaceGroup& shadingSurfaceGroup, QDomDocument& doc);
     boost::optional<QDomElement> translateBuildingStory(const openstudio::model::BuildingStory& story, QDomDocument& doc);
@@ -102,7 +111,7 @@ namespace gbxml {
     boost::optional<QDomElement> translateMaterial(const openstudio::model::Material& material, QDomDocument& doc);
     boost::optional<QDomElement> translateConstructionBase(const openstudio::model::ConstructionBase& constructionBase, QDomDocument& doc);
 
-    std::map<openstudio::Handle, QDomElement> m_translatedObjects;
+    std::set<openstudio::Handle> m_translatedObjects;
 
     std::set<openstudio::model::Material, openstudio::IdfObjectImplLess> m_materials;
 
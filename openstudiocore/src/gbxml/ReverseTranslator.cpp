@@ -69,7 +69,12 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QFile>
 #include <QThread>
+#include <QXmlStreamReader>
+
+#include <algorithm>
+#include <functional>
 
 namespace openstudio {
 namespace gbxml {
@@ -83,8 +88,51 @@ namespace gbxml {
     return os;
   }
 
+  namespace {
+
+    // appends the element at the current StartElement of reader and its content to parent, in the same way
+    // as QDomDocument::setContent without namespace processing, child elements for which skipChild returns
+    // true are skipped
+    void readElement(QXmlStreamReader& reader, QDomDocument& doc, QDomNode& parent,
+                     const std::function<bool (const QDomElement&, const QXmlStreamReader&)>& skipChild)
+    {
+      QDomElement element = doc.createElement(reader.qualifiedName().toString());
+      for (const QXmlStreamAttribute& attribute : reader.attributes()){
+        element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+      }
+      parent.appendChild(element);
+
+      // text between elements is dropped if it is only whitespace
+      QString text;
+      auto appendText = [&](){
+        if (!text.trimmed().isEmpty()){
+          element.appendChild(doc.createTextNode(text));
+        }
+        text.clear();
+      };
+
+      while (!reader.atEnd()){
+        QXmlStreamReader::TokenType token = reader.readNext();
+        if (token == QXmlStreamReader::Characters){
+          text += reader.text();
+        }else if (token == QXmlStreamReader::StartElement){
+          appendText();
+          if (skipChild && skipChild(element, reader)){
+            reader.skipCurrentElement();
+          }else{
+            readElement(reader, doc, element, skipChild);
+          }
+        }else if (token == QXmlStreamReader::EndElement){
+          appendText();
+          return;
+        }
+      }
+    }
+
+  } // anonymous
+
   ReverseTranslator::ReverseTranslator()
-    : m_lengthMultiplier(1.0)
+    : m_lengthMultiplier(1.0), m_surfaceDevice(nullptr)
   {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.gbxml\\.ReverseTranslator"));
@@ -107,13 +155,16 @@ namespace gbxml {
 
     if (openstudio::filesystem::exists(path)){
 
-      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
-      if (file.is_open()) {
+      // surfaces are read from the file one at a time while they are translated rather than kept in the document
+      QFile file(toQString(path));
+      if (file.open(QIODevice::ReadOnly)) {
         QDomDocument doc;
-        doc.setContent(openstudio::filesystem::read_as_QByteArray(file));
+        if (readDocument(file, doc)){
+          m_surfaceDevice = &file;
+          result = this->convert(doc);
+          m_surfaceDevice = nullptr;
+        }
         file.close();
-
-        result = this->convert(doc);
       }
     }
 
@@ -159,7 +210,158 @@ namespace gbxml {
 
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
-    return translateGBXML(doc.documentElement(), doc);
+    indexElements(doc.documentElement());
+
+    boost::optional<model::Model> result = translateGBXML(doc.documentElement(), doc);
+
+    m_elementsByTagName.clear();
+    m_elementsById.clear();
+
+    return result;
+  }
+
+  void ReverseTranslator::indexElements(const QDomElement& root)
+  {
+    m_elementsByTagName.clear();
+    m_elementsById.clear();
+
+    // pre-order traversal of all descendants of root, same order as elementsByTagName
+    QDomElement element = root.firstChildElement();
+    while (!element.isNull()){
+      QString tagName = element.tagName();
+      m_elementsByTagName[tagName].push_back(element);
+
+      QString id = element.attribute("id");
+      if (!id.isEmpty()){
+        // keep the first element with a given id, as the previous linear searches did
+        m_elementsById.insert(std::make_pair(std::make_pair(tagName, id), element));
+      }
+
+      QDomElement next = element.firstChildElement();
+      if (next.isNull()){
+        QDomElement current = element;
+        while (next.isNull() && (current != root)){
+          next = current.nextSiblingElement();
+          if (next.isNull()){
+            current = current.parentNode().toElement();
+          }
+        }
+      }
+      element = next;
+    }
+  }
+
+  const std::vector<QDomElement>& ReverseTranslator::indexedElements(const QString& tagName) const
+  {
+    static const std::vector<QDomElement> empty;
+
+    auto it = m_elementsByTagName.find(tagName);
+    if (it != m_elementsByTagName.end()){
+      return it->second;
+    }
+    return empty;
+  }
+
+  std::vector<QDomElement> ReverseTranslator::indexedElements(const QDomElement& ancestor, const QString& tagName) const
+  {
+    std::vector<QDomElement> result;
+    for (const QDomElement& element : indexedElements(tagName)){
+      for (QDomNode parent = element.parentNode(); !parent.isNull(); parent = parent.parentNode()){
+        if (parent == ancestor){
+          result.push_back(element);
+          break;
+        }
+      }
+    }
+    return result;
+  }
+
+  boost::optional<QDomElement> ReverseTranslator::indexedElement(const QString& tagName, const QString& id) const
+  {
+    auto it = m_elementsById.find(std::make_pair(tagName, id));
+    if (it != m_elementsById.end()){
+      return it->second;
+    }
+    return boost::none;
+  }
+
+  bool ReverseTranslator::readDocument(QIODevice& device, QDomDocument& doc)
+  {
+    m_numStreamedSurfaces.clear();
+
+    QXmlStreamReader reader(&device);
+    reader.setNamespaceProcessing(false);
+    while (!reader.atEnd() && (reader.readNext() != QXmlStreamReader::StartElement)){
+    }
+
+    if (reader.isStartElement()){
+      readElement(reader, doc, doc, [this](const QDomElement& parent, const QXmlStreamReader& child){
+        if (child.qualifiedName() == "Campus"){
+          m_numStreamedSurfaces.push_back(0);
+        }else if ((parent.tagName() == "Campus") && (child.qualifiedName() == "Surface")){
+          ++m_numStreamedSurfaces.back();
+          return true;
+        }
+        return false;
+      });
+    }
+
+    if (reader.hasError() || doc.documentElement().isNull()){
+      LOG(Error, "Could not read gbXML document: " << toString(reader.errorString()));
+      return false;
+    }
+
+    return true;
+  }
+
+  void ReverseTranslator::translateStreamedSurfaces(unsigned campusIndex, const QDomDocument& doc, openstudio::model::Model& model)
+  {
+    if (!m_surfaceDevice || !m_surfaceDevice->seek(0)){
+      return;
+    }
+
+    QXmlStreamReader reader(m_surfaceDevice);
+    reader.setNamespaceProcessing(false);
+
+    // names of the open elements
+    std::vector<QString> openElements;
+    int campus = -1;
+
+    while (!reader.atEnd()){
+      QXmlStreamReader::TokenType token = reader.readNext();
+      if (token == QXmlStreamReader::StartElement){
+        QString name = reader.qualifiedName().toString();
+        if (name == "Campus"){
+          ++campus;
+        }else if ((name == "Surface") && !openElements.empty() && (openElements.back() == "Campus")){
+          if (campus == static_cast<int>(campusIndex)){
+            // the surface is the only element of its own document
+            QDomDocument surfaceDoc;
+            readElement(reader, surfaceDoc, surfaceDoc, nullptr);
+            QDomElement surfaceElement = surfaceDoc.documentElement();
+            try {
+              boost::optional<model::ModelObject> surface = translateSurface(surfaceElement, doc, model);
+            }catch(const std::exception&){
+              LOG(Error, "Could not translate surface " << surfaceElement);
+            }
+
+            if (m_progressBar){
+              m_progressBar->setValue(m_progressBar->value() + 1);
+            }
+          }else{
+            reader.skipCurrentElement();
+          }
+          continue;
+        }
+        openElements.push_back(name);
+      }else if (token == QXmlStreamReader::EndElement){
+        openElements.pop_back();
+      }
+    }
+
+    if (reader.hasError()){
+      LOG(Error, "Could not read surfaces from gbXML document: " << toString(reader.errorString()));
+    }
   }
 
   boost::optional<model::Model> ReverseTranslator::translateGBXML(const QDomElement& element, const QDomDocument& doc)
@@ -229,16 +431,15 @@ namespace gbxml {
     }
 
     // do materials before constructions 
-    QDomNodeList materialElements = element.elementsByTagName("Material");
+    const std::vector<QDomElement>& materialElements = indexedElements("Material");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Materials"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(materialElements.count()); 
+      m_progressBar->setMaximum(materialElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < materialElements.count(); i++){
-      QDomElement materialElement = materialElements.at(i).toElement();
+    for (const QDomElement& materialElement : materialElements){
       boost::optional<model::ModelObject> material = translateMaterial(materialElement, doc, model);
       OS_ASSERT(material); // Krishnan, what type of error handling do you want?
       
@@ -248,18 +449,16 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    QDomNodeList layerElements = element.elementsByTagName("Layer");
-    QDomNodeList constructionElements = element.elementsByTagName("Construction");
+    const std::vector<QDomElement>& constructionElements = indexedElements("Construction");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(constructionElements.count()); 
+      m_progressBar->setMaximum(constructionElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < constructionElements.count(); i++){
-      QDomElement constructionElement = constructionElements.at(i).toElement();
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, doc, model);
+    for (const QDomElement& constructionElement : constructionElements){
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
       
       if (m_progressBar){
@@ -268,16 +467,15 @@ namespace gbxml {
     }
     
     // do window type before sub surfaces
-    QDomNodeList windowTypeElements = element.elementsByTagName("WindowType");
+    const std::vector<QDomElement>& windowTypeElements = indexedElements("WindowType");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Window Types"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(windowTypeElements.count()); 
+      m_progressBar->setMaximum(windowTypeElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < windowTypeElements.count(); i++){
-      QDomElement windowTypeElement = windowTypeElements.at(i).toElement();
+    for (const QDomElement& windowTypeElement : windowTypeElements){
       boost::optional<model::ModelObject> construction = translateWindowType(windowTypeElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
       
@@ -287,16 +485,15 @@ namespace gbxml {
     }
 
     // do schedules before loads
-    QDomNodeList scheduleElements = element.elementsByTagName("Schedule");
+    const std::vector<QDomElement>& scheduleElements = indexedElements("Schedule");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Schedules"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(scheduleElements.count()); 
+      m_progressBar->setMaximum(scheduleElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < scheduleElements.count(); i++){
-      QDomElement scheduleElement = scheduleElements.at(i).toElement();
+    for (const QDomElement& scheduleElement : scheduleElements){
       boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, doc, model);
       OS_ASSERT(schedule); // Krishnan, what type of error handling do you want?
       
@@ -306,16 +503,15 @@ namespace gbxml {
     }
 
     // do thermal zones before spaces
-    QDomNodeList zoneElements = element.elementsByTagName("Zone");
+    const std::vector<QDomElement>& zoneElements = indexedElements("Zone");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Zones"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(zoneElements.count()); 
+      m_progressBar->setMaximum(zoneElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < zoneElements.count(); i++){
-      QDomElement zoneElement = zoneElements.at(i).toElement();
+    for (const QDomElement& zoneElement : zoneElements){
       boost::optional<model::ModelObject> zone = translateThermalZone(zoneElement, doc, model);
       OS_ASSERT(zone); // Krishnan, what type of error handling do you want?
       
@@ -324,9 +520,9 @@ namespace gbxml {
       }
     }
 
-    QDomNodeList campusElements = element.elementsByTagName("Campus");
-    OS_ASSERT(campusElements.count() == 1);
-    QDomElement campusElement = campusElements.at(0).toElement();
+    const std::vector<QDomElement>& campusElements = indexedElements("Campus");
+    OS_ASSERT(campusElements.size() == 1);
+    QDomElement campusElement = campusElements[0];
     boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
     OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
 
@@ -339,26 +535,34 @@ namespace gbxml {
   {
     openstudio::model::Facility facility = model.getUniqueModelObject<openstudio::model::Facility>();
 
-    QDomNodeList buildingElements = element.elementsByTagName("Building");
-    OS_ASSERT(buildingElements.count() == 1);
+    std::vector<QDomElement> buildingElements = indexedElements(element, "Building");
+    OS_ASSERT(buildingElements.size() == 1);
 
-    boost::optional<model::ModelObject> building = translateBuilding(buildingElements.at(0).toElement(), doc, model);
+    boost::optional<model::ModelObject> building = translateBuilding(buildingElements[0], doc, model);
     OS_ASSERT(building);
 
-    QDomNodeList surfaceElements = element.elementsByTagName("Surface");
+    // surfaces directly in the campus are streamed from the file rather than kept in the document
+    const std::vector<QDomElement>& campusElements = indexedElements("Campus");
+    unsigned campusIndex = std::find(campusElements.begin(), campusElements.end(), element) - campusElements.begin();
+    unsigned numStreamedSurfaces = 0;
+    if (m_surfaceDevice && (campusIndex < m_numStreamedSurfaces.size())){
+      numStreamedSurfaces = m_numStreamedSurfaces[campusIndex];
+    }
+
+    std::vector<QDomElement> surfaceElements = indexedElements(element, "Surface");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Surfaces"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(surfaceElements.count()); 
+      m_progressBar->setMaximum(surfaceElements.size() + numStreamedSurfaces); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < surfaceElements.count(); ++i){
+    for (const QDomElement& surfaceElement : surfaceElements){
 
       try {
-        boost::optional<model::ModelObject> surface = translateSurface(surfaceElements.at(i).toElement(), doc, model);
+        boost::optional<model::ModelObject> surface = translateSurface(surfaceElement, doc, model);
       }catch(const std::exception&){
-        LOG(Error, "Could not translate surface " << surfaceElements.at(i).toElement());
+        LOG(Error, "Could not translate surface " << surfaceElement);
       }
       
       if (m_progressBar){
@@ -366,6 +570,10 @@ namespace gbxml {
       }
     }
 
+    if (numStreamedSurfaces > 0){
+      translateStreamedSurfaces(campusIndex, doc, model);
+    }
+
     return facility;
   }
 
@@ -379,16 +587,16 @@ namespace gbxml {
     QString name = element.firstChildElement("Name").toElement().text();
     building.setName(escapeName(id, name));
 
-    QDomNodeList storyElements = element.elementsByTagName("BuildingStorey");
+    std::vector<QDomElement> storyElements = indexedElements(element, "BuildingStorey");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Building Stories"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(storyElements.count()); 
+      m_progressBar->setMaximum(storyElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < storyElements.count(); ++i){
-      boost::optional<model::ModelObject> story = translateBuildingStory(storyElements.at(i).toElement(), doc, model);
+    for (const QDomElement& storyElement : storyElements){
+      boost::optional<model::ModelObject> story = translateBuildingStory(storyElement, doc, model);
       OS_ASSERT(story);
 
       if (m_progressBar){
@@ -396,16 +604,16 @@ namespace gbxml {
       }
     }
 
-    QDomNodeList spaceElements = element.elementsByTagName("Space");
+    std::vector<QDomElement> spaceElements = indexedElements(element, "Space");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Spaces"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(spaceElements.count()); 
+      m_progressBar->setMaximum(spaceElements.size()); 
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < spaceElements.count(); ++i){
-      boost::optional<model::ModelObject> space = translateSpace(spaceElements.at(i).toElement(), doc, model);
+    for (const QDomElement& spaceElement : spaceElements){
+      boost::optional<model::ModelObject> space = translateSpace(spaceElement, doc, model);
       OS_ASSERT(space);
 
       if (m_progressBar){
@@ -43,6 +43,7 @@
 class QDomDocument;
 class QDomElement;
 class QDomNodeList;
+class QIODevice;
 
 namespace openstudio {
 
@@ -86,13 +87,40 @@ namespace gbxml {
 
     std::map<QString, openstudio::model::ModelObject> m_idToObjectMap;
 
+    // builds an index of all elements by tag name and by id in a single pass over the document,
+    // replaces repeated elementsByTagName walks and linear searches for referenced elements
+    void indexElements(const QDomElement& root);
+
+    // elements with tag name in document order, empty if none
+    const std::vector<QDomElement>& indexedElements(const QString& tagName) const;
+
+    // elements with tag name which are descendants of ancestor in document order, empty if none
+    std::vector<QDomElement> indexedElements(const QDomElement& ancestor, const QString& tagName) const;
+
+    // element with tag name and id attribute, empty if not found
+    boost::optional<QDomElement> indexedElement(const QString& tagName, const QString& id) const;
+
+    std::map<QString, std::vector<QDomElement> > m_elementsByTagName;
+    std::map<std::pair<QString, QString>, QDomElement> m_elementsById;
+
+    // reads the document from device without the Surface elements of each Campus, which are the bulk of
+    // a gbXML file, the number of Surface elements left out of each Campus is stored in m_numStreamedSurfaces
+    bool readDocument(QIODevice& device, QDomDocument& doc);
+
+    // translates the Surface elements of the campusIndex'th Campus one at a time from m_surfaceDevice
+    void translateStreamedSurfaces(unsigned campusIndex, const QDomDocument& doc, openstudio::model::Model& model);
+
+    // device the document was read from while it is translated
+    QIODevice* m_surfaceDevice;
+    std::vector<unsigned> m_numStreamedSurfaces;
+
     boost::optional<openstudio::model::Model> convert(const QDomDocument& doc);
     boost::optional<openstudio::model::Model> translateGBXML(const QDomElement& element, const QDomDocument& doc);
     boost::optional<openstudio::model::ModelObject> translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
@@ -33,11 +33,19 @@
 #include "../ReverseTranslator.hpp"
 
 #include "../../model/Model.hpp"
+#include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
 
 #include <resources.hxx>
 
 #include <sstream>
 
+#include <QDomDocument>
+
 using namespace openstudio::model;
 using namespace openstudio::gbxml;
 using namespace openstudio;
@@ -64,3 +72,68 @@ TEST_F(gbXMLFixture, ForwardTranslator_exampleModel)
   path p2 = resourcesPath() / openstudio::toPath("gbxml/exampleModel2.osm");
   model2->save(p2, true);
 }
+
+TEST_F(gbXMLFixture, ForwardTranslator_exampleModel_Stream)
+{
+  Model model = exampleModel();
+
+  std::stringstream ss;
+
+  ForwardTranslator forwardTranslator;
+  bool test = forwardTranslator.modelToGbXML(model, ss);
+
+  EXPECT_TRUE(test);
+
+  std::string xml = ss.str();
+  EXPECT_EQ(0u, xml.find("<gbXML "));
+  EXPECT_NE(std::string::npos, xml.find("</gbXML>"));
+
+  auto countOf = [&xml](const std::string& s) {
+    unsigned result = 0;
+    for (std::string::size_type pos = xml.find(s); pos != std::string::npos; pos = xml.find(s, pos + 1)){
+      ++result;
+    }
+    return result;
+  };
+
+  EXPECT_EQ(1u, countOf("<Campus "));
+  EXPECT_EQ(1u, countOf("<Building "));
+  EXPECT_EQ(model.getConcreteModelObjects<ThermalZone>().size(), countOf("<Zone "));
+  EXPECT_EQ(model.getConcreteModelObjects<BuildingStory>().size(), countOf("<BuildingStorey "));
+
+  path p = resourcesPath() / openstudio::toPath("gbxml/exampleModel_Stream.xml");
+  openstudio::filesystem::ofstream file(p, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+  file << xml;
+  file.close();
+
+  ReverseTranslator reverseTranslator;
+  boost::optional<Model> model2 = reverseTranslator.loadModel(p);
+
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.getConcreteModelObjects<ThermalZone>().size(), model2->getConcreteModelObjects<ThermalZone>().size());
+}
+
+TEST_F(gbXMLFixture, ForwardTranslator_Stream_Escaping)
+{
+  Model model = exampleModel();
+
+  std::vector<ThermalZone> thermalZones = model.getConcreteModelObjects<ThermalZone>();
+  ASSERT_FALSE(thermalZones.empty());
+  std::string name = "Zone <1> & \"A\" ]]> 'B'";
+  thermalZones[0].setName(name);
+
+  std::stringstream ss;
+  ForwardTranslator forwardTranslator;
+  EXPECT_TRUE(forwardTranslator.modelToGbXML(model, ss));
+
+  // text is escaped the same way as QDomDocument::toString
+  QDomDocument doc;
+  QDomElement nameElement = doc.createElement("Name");
+  doc.appendChild(nameElement);
+  nameElement.appendChild(doc.createTextNode(QString::fromStdString(name)));
+  std::string expected = doc.toString(2).trimmed().toStdString();
+  EXPECT_EQ("<Name>Zone &lt;1> &amp; \"A\" ]]&gt; 'B'</Name>", expected);
+
+  EXPECT_NE(std::string::npos, ss.str().find(expected));
+}
@@ -45,6 +45,14 @@
 #include "../../model/Space_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/Surface_Impl.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/Construction_Impl.hpp"
+#include "../../model/ScheduleYear.hpp"
+#include "../../model/ScheduleYear_Impl.hpp"
+#include "../../model/ScheduleWeek.hpp"
+#include "../../model/ScheduleWeek_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
@@ -141,3 +149,54 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane)
   bool test = forwardTranslator.modelToGbXML(*model, outputPath);
   EXPECT_TRUE(test);
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane_References)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TwoStoryOffice_Trane.xml");
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  // layers are looked up by id from the construction
+  boost::optional<Construction> construction = model->getModelObjectByName<Construction>("4 in face brick- 2 in insulation- 8 in light concrete block");
+  ASSERT_TRUE(construction);
+  EXPECT_EQ(5u, construction->numLayers());
+
+  construction = model->getModelObjectByName<Construction>("Metal");
+  ASSERT_TRUE(construction);
+  EXPECT_EQ(3u, construction->numLayers());
+
+  // week and day schedules are looked up by id from the year schedule
+  boost::optional<ScheduleYear> scheduleYear = model->getModelObjectByName<ScheduleYear>("School Occupancy - 8 AM to 9 PM");
+  ASSERT_TRUE(scheduleYear);
+  std::vector<ScheduleWeek> scheduleWeeks = scheduleYear->scheduleWeeks();
+  ASSERT_EQ(1u, scheduleWeeks.size());
+  EXPECT_TRUE(scheduleWeeks[0].sundaySchedule());
+  EXPECT_TRUE(scheduleWeeks[0].mondaySchedule());
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane_Surfaces)
+{
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TwoStoryOffice_Trane.xml");
+  openstudio::path outputPath = resourcesPath() / openstudio::toPath("gbxml/TwoStoryOffice_Trane_Surfaces.xml");
+
+  // surfaces are streamed from the file after the rest of the document is translated
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  std::vector<Surface> surfaces = model->getModelObjects<Surface>();
+  ASSERT_FALSE(surfaces.empty());
+  for (const Surface& surface : surfaces){
+    EXPECT_TRUE(surface.space());
+  }
+
+  openstudio::gbxml::ForwardTranslator forwardTranslator;
+  ASSERT_TRUE(forwardTranslator.modelToGbXML(*model, outputPath));
+
+  boost::optional<openstudio::model::Model> model2 = reverseTranslator.loadModel(outputPath);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(surfaces.size(), model2->getModelObjects<Surface>().size());
+  EXPECT_EQ(model->getModelObjects<Space>().size(), model2->getModelObjects<Space>().size());
+}
@@ -63,6 +63,7 @@
 #include "../utilities/math/FloatCompare.hpp"
 #include "../utilities/data/DataEnums.hpp"
 #include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/PolygonBatch.hpp"
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/core/Compare.hpp"
 #include "../utilities/core/Assert.hpp"
@@ -76,6 +77,21 @@ namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // keys of the Building metrics cached by Model_Impl::cachedMetric
+    const std::string floorAreaMetric("floorArea");
+    const std::string exteriorSurfaceAreaMetric("exteriorSurfaceArea");
+    const std::string exteriorWallAreaMetric("exteriorWallArea");
+    const std::string airVolumeMetric("airVolume");
+    const std::string numberOfPeopleMetric("numberOfPeople");
+    const std::string lightingPowerMetric("lightingPower");
+    const std::string electricEquipmentPowerMetric("electricEquipmentPower");
+    const std::string gasEquipmentPowerMetric("gasEquipmentPower");
+    const std::string infiltrationDesignFlowRateMetric("infiltrationDesignFlowRate");
+
+  } // anonymous
+
   Building_Impl::Building_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ParentObject_Impl(idfObject, model, keepHandle)
   {
@@ -556,14 +572,16 @@ namespace detail {
 
   double Building_Impl::floorArea() const
   {
-    double result = 0;
-    for (const Space& space : spaces()){
-      bool partofTotalFloorArea = space.partofTotalFloorArea();
-      if (partofTotalFloorArea) {
-        result += space.multiplier() * space.floorArea();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), floorAreaMetric, [this]() {
+      double result = 0;
+      for (const Space& space : spaces()){
+        bool partofTotalFloorArea = space.partofTotalFloorArea();
+        if (partofTotalFloorArea) {
+          result += space.multiplier() * space.floorArea();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   boost::optional<double> Building_Impl::conditionedFloorArea() const
@@ -594,41 +612,65 @@ namespace detail {
   }
 
   double Building_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-      OptionalSpace space = surface.space();
-      std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-      if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-        result += surface.grossArea() * space->multiplier();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), exteriorSurfaceAreaMetric, [this]() {
+      std::vector<PlanarSurface> exteriorSurfaces;
+      std::vector<double> multipliers;
+      for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
+        OptionalSpace space = surface.space();
+        std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
+        if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
+          exteriorSurfaces.push_back(surface);
+          multipliers.push_back(space->multiplier());
+        }
       }
-    }
-    return result;
+
+      double result(0.0);
+      PolygonBatch geometry = PlanarSurface::computeGeometry(exteriorSurfaces);
+      for (unsigned i = 0; i < geometry.numPolygons(); ++i) {
+        result += geometry.areas()[i] * multipliers[i];
+      }
+      return result;
+    });
   }
 
   double Building_Impl::exteriorWallArea() const {
-    double result(0.0);
-    for (const Surface& exteriorWall : exteriorWalls()) {
-      if (OptionalSpace space = exteriorWall.space()) {
-        result += exteriorWall.grossArea() * space->multiplier();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), exteriorWallAreaMetric, [this]() {
+      std::vector<PlanarSurface> walls;
+      std::vector<double> multipliers;
+      for (const Surface& exteriorWall : exteriorWalls()) {
+        if (OptionalSpace space = exteriorWall.space()) {
+          walls.push_back(exteriorWall);
+          multipliers.push_back(space->multiplier());
+        }
       }
-    }
-    return result;
+
+      double result(0.0);
+      PolygonBatch geometry = PlanarSurface::computeGeometry(walls);
+      for (unsigned i = 0; i < geometry.numPolygons(); ++i) {
+        result += geometry.areas()[i] * multipliers[i];
+      }
+      return result;
+    });
   }
 
   double Building_Impl::airVolume() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.volume() * space.multiplier();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), airVolumeMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.volume() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::numberOfPeople() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.numberOfPeople() * space.multiplier();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), numberOfPeopleMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.numberOfPeople() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::peoplePerFloorArea() const {
@@ -656,11 +698,13 @@ namespace detail {
   }
 
   double Building_Impl::lightingPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.lightingPower();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), lightingPowerMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.lightingPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::lightingPowerPerFloorArea() const {
@@ -694,11 +738,13 @@ namespace detail {
   }
 
   double Building_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.electricEquipmentPower();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), electricEquipmentPowerMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.electricEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -732,11 +778,13 @@ namespace detail {
   }
 
   double Building_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.gasEquipmentPower();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), gasEquipmentPowerMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.gasEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -770,11 +818,13 @@ namespace detail {
   }
 
   double Building_Impl::infiltrationDesignFlowRate() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.infiltrationDesignFlowRate();
-    }
-    return result;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignFlowRateMetric, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.infiltrationDesignFlowRate();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
@@ -83,13 +83,15 @@ namespace detail {
 
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_cachedMetricsChangeCount(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_cachedMetricsChangeCount(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -101,7 +103,8 @@ namespace detail {
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_cachedMetricsChangeCount(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
     if (iddFileType() != IddFileType::OpenStudio) {
@@ -115,7 +118,8 @@ namespace detail {
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
       m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_cachedMetricsChangeCount(0)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
@@ -128,7 +132,8 @@ namespace detail {
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
       m_workflowJSON(WorkflowJSON(other.m_workflowJSON)),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_cachedMetricsChangeCount(0)
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
   }
@@ -1486,6 +1491,35 @@ if (_className::iddObjectType() == typeToCreate) { \
     return spaceType;
   }
 
+  boost::optional<double> Model_Impl::cachedMetric(const Handle& handle, const std::string& metric) const
+  {
+    if (m_cachedMetricsChangeCount != changeCount()) {
+      m_cachedMetrics.clear();
+      m_cachedMetricsChangeCount = changeCount();
+      return boost::none;
+    }
+
+    auto it = m_cachedMetrics.find(std::make_pair(handle, metric));
+    if (it == m_cachedMetrics.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
+  void Model_Impl::setCachedMetric(const Handle& handle, const std::string& metric, double value, unsigned long long changeCount) const
+  {
+    // computing value changed the model, e.g. by creating a default object
+    if (changeCount != this->changeCount()) {
+      return;
+    }
+
+    if (m_cachedMetricsChangeCount != changeCount) {
+      m_cachedMetrics.clear();
+      m_cachedMetricsChangeCount = changeCount;
+    }
+    m_cachedMetrics[std::make_pair(handle, metric)] = value;
+  }
+
   WorkflowJSON Model_Impl::workflowJSON() const
   {
     return m_workflowJSON;
@@ -46,6 +46,7 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
 #include <vector>
 
 namespace openstudio {
@@ -181,6 +182,28 @@ namespace detail {
 
     SpaceType plenumSpaceType() const;
 
+    /** Returns the value of metric for the object with handle if it was stored with setCachedMetric
+     *  and the model has not changed since. */
+    boost::optional<double> cachedMetric(const Handle& handle, const std::string& metric) const;
+
+    /** Stores the value of metric for the object with handle until the model changes. changeCount is
+     *  the changeCount() read before value was computed; value is discarded if the model changed since. */
+    void setCachedMetric(const Handle& handle, const std::string& metric, double value, unsigned long long changeCount) const;
+
+    /** Returns the cached value of metric for the object with handle, computing it with compute() and
+     *  caching the result if it is not cached. */
+    template <typename ComputeFunction>
+    double cachedMetric(const Handle& handle, const std::string& metric, ComputeFunction compute) const
+    {
+      unsigned long long changeCount = this->changeCount();
+      if (boost::optional<double> cached = cachedMetric(handle, metric)) {
+        return *cached;
+      }
+      double result = compute();
+      setCachedMetric(handle, metric, result, changeCount);
+      return result;
+    }
+
     //@}
     /** @name Setters */
     //@{
@@ -283,6 +306,10 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    // metrics of model objects, valid while changeCount() equals m_cachedMetricsChangeCount
+    mutable std::map<std::pair<Handle, std::string>, double> m_cachedMetrics;
+    mutable unsigned long long m_cachedMetricsChangeCount;
+
   // private slots:
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
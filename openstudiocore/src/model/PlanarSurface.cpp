@@ -50,6 +50,7 @@
 #include "../utilities/sql/SqlFile.hpp"
 
 #include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/PolygonBatch.hpp"
 #include "../utilities/geometry/Transformation.hpp"
 
 #include "../utilities/core/Assert.hpp"
@@ -59,6 +60,8 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <cmath>
+
 using openstudio::Handle;
 using openstudio::OptionalHandle;
 using openstudio::HandleVector;
@@ -251,12 +254,15 @@ namespace model {
     // compute gross area (m^2)
     double PlanarSurface_Impl::grossArea() const
     {
-      double result = 0.0;
-      OptionalDouble area = getArea(vertices());
-      if (area){
-        result = *area;
+      if (!m_cachedGrossArea){
+        double result = 0.0;
+        OptionalDouble area = getArea(vertices());
+        if (area){
+          result = *area;
+        }
+        m_cachedGrossArea = result;
       }
-      return result;
+      return m_cachedGrossArea.get();
     }
 
     // compute net area (m^2)
@@ -431,23 +437,14 @@ namespace model {
         if (sqlFile) {
           OptionalString surfaceName = this->name();
           //OptionalString constructionName = oConstruction->name();
-          std::string query;
           if (surfaceName){
 
             if (!outputResult){
-              std::stringstream ss;
-              ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Exterior Fenestration' AND RowName='";
-              ss << to_upper_copy(*surfaceName) << "' AND ColumnName='Glass Visible Transmittance'";
-              query = ss.str();
-              outputResult = sqlFile->execAndReturnFirstDouble(query);
+              outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", to_upper_copy(*surfaceName), "Glass Visible Transmittance");
             }
 
             if (!outputResult){
-              std::stringstream ss;
-              ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Interior Fenestration' AND RowName='";
-              ss << to_upper_copy(*surfaceName) << "' AND ColumnName='Glass Visible Transmittance'";
-              query = ss.str();
-              outputResult = sqlFile->execAndReturnFirstDouble(query);
+              outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Interior Fenestration", to_upper_copy(*surfaceName), "Glass Visible Transmittance");
             }
           }
         }
@@ -556,6 +553,18 @@ namespace model {
       return *result;
     }
 
+    void PlanarSurface_Impl::setCachedGeometry(const PolygonBatch& batch, unsigned index) const
+    {
+      OS_ASSERT(index < batch.numPolygons());
+
+      // same results as getArea and getOutwardNormal
+      boost::optional<double> area = batch.area(index);
+      m_cachedGrossArea = area ? *area : 0.0;
+      if (boost::optional<Vector3d> outwardNormal = batch.outwardNormal(index)){
+        m_cachedOutwardNormal = outwardNormal;
+      }
+    }
+
     std::vector<ModelObject> PlanarSurface_Impl::solarCollectors() const
     {
       std::vector<ModelObject> result;
@@ -607,11 +616,18 @@ namespace model {
       return result;
     }
 
+    void PlanarSurface_Impl::emitChangeSignals()
+    {
+      clearCachedVariables();
+      ParentObject_Impl::emitChangeSignals();
+    }
+
     void PlanarSurface_Impl::clearCachedVariables()
     {
       m_cachedVertices.reset();
       m_cachedPlane.reset();
       m_cachedOutwardNormal.reset();
+      m_cachedGrossArea.reset();
       m_cachedTriangulation.clear();
     }
 
@@ -867,10 +883,10 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
   }
 
   std::map<PlanarSurfaceGroup, Transformation> siteTransformationMap;
-  Vector3d up(0.0,0.0,1.0);
-  Vector3d north(0.0,1.0,0.0);
 
-  // inputs ok, loop over surfaces
+  // vertices in site coordinates
+  std::vector<std::vector<Point3d> > siteVertices;
+  siteVertices.reserve(planarSurfaces.size());
   for (const PlanarSurface& planarSurface : planarSurfaces){
 
     // find the transformation to site coordinates
@@ -888,16 +904,24 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
       }
     }
 
-    // vertices and outward normal in site coordinates
-    Point3dVector siteVertices = siteTransformation * planarSurface.vertices();
-    OptionalVector3d siteOutwardNormal = getOutwardNormal(siteVertices);
+    siteVertices.push_back(siteTransformation * planarSurface.vertices());
+  }
+
+  // outward normals, tilts and azimuths in site coordinates in one pass
+  PolygonBatch siteGeometry(siteVertices);
+  const std::vector<double>& tilts = siteGeometry.tilts();
+  const std::vector<double>& azimuths = siteGeometry.azimuths();
 
-    if (!siteOutwardNormal){
+  // inputs ok, loop over surfaces
+  for (unsigned i = 0; i < planarSurfaces.size(); ++i){
+    const PlanarSurface& planarSurface = planarSurfaces[i];
+
+    if (std::isnan(tilts[i])){
       LOG(Error, "Could not compute outward normal for planarSurface " << planarSurface);
       continue;
     }
 
-    double degreesTilt = radToDeg( getAngle(*siteOutwardNormal, up) );
+    double degreesTilt = radToDeg(tilts[i]);
 
     if (minDegreesTilt && (*minDegreesTilt - tol > degreesTilt)){
       continue;
@@ -907,12 +931,7 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
       continue;
     }
 
-    double degreesFromNorth;
-    if (siteOutwardNormal->x() < 0.0){
-      degreesFromNorth = 360 - radToDeg( getAngle(*siteOutwardNormal, north) );
-    }else{
-      degreesFromNorth = radToDeg( getAngle(*siteOutwardNormal, north) );
-    }
+    double degreesFromNorth = radToDeg(azimuths[i]);
 
     if (minDegreesFromNorth && maxDegreesFromNorth){
       if (*maxDegreesFromNorth >= *minDegreesFromNorth){
@@ -937,6 +956,23 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
   return result;
 }
 
+PolygonBatch PlanarSurface::computeGeometry(const std::vector<PlanarSurface>& planarSurfaces)
+{
+  std::vector<std::vector<Point3d> > polygons;
+  polygons.reserve(planarSurfaces.size());
+  for (const PlanarSurface& planarSurface : planarSurfaces){
+    polygons.push_back(planarSurface.vertices());
+  }
+
+  PolygonBatch result(polygons);
+
+  for (unsigned i = 0; i < planarSurfaces.size(); ++i){
+    planarSurfaces[i].getImpl<detail::PlanarSurface_Impl>()->setCachedGeometry(result, i);
+  }
+
+  return result;
+}
+
 double PlanarSurface::filmResistance(const FilmResistanceType& type) {
   // assumes suface emmittance of 0.90
   switch (type.value()) {
@@ -37,6 +37,7 @@ namespace openstudio {
 class Plane;
 class Point3d;
 class Vector3d;
+class PolygonBatch;
 
 namespace model {
 
@@ -132,6 +133,12 @@ class MODEL_API PlanarSurface : public ParentObject {
                                                        boost::optional<double> maxDegreesTilt,
                                                        double tol = 1);
 
+  /** Computes the gross area, outward normal, centroid, tilt and azimuth of planarSurfaces in one pass
+   *  over their packed vertices, polygon i of the result belongs to planarSurfaces[i]. Geometry is in
+   *  the local coordinates of each surface. The gross areas and outward normals found are kept in the
+   *  cached geometry of each surface. */
+  static PolygonBatch computeGeometry(const std::vector<PlanarSurface>& planarSurfaces);
+
   /** Film resistances from ASHRAE Fundamentals, Chapter 25, Table 1 for non-reflective surfaces.
    *  Units of m^2*K/W. */
   static double filmResistance(const FilmResistanceType& type);
@@ -125,6 +125,12 @@ namespace detail {
     return transformation;
   }
 
+  void PlanarSurfaceGroup_Impl::emitChangeSignals()
+  {
+    clearCachedVariables();
+    ParentObject_Impl::emitChangeSignals();
+  }
+
   void PlanarSurfaceGroup_Impl::clearCachedVariables()
   {
     m_cachedTransformation.reset();
@@ -114,6 +114,14 @@ namespace detail {
     /** Get the BoundingBox in local coordinates. */
     virtual openstudio::BoundingBox boundingBox() const = 0;
 
+    //@}
+    /** @name Signal Helpers */
+    //@{
+
+    /** Clears the cached transformation, then emits signals. The cached transformation is cleared even while a
+     *  Workspace edit transaction holds the signals back. */
+    virtual void emitChangeSignals() override;
+
     //@}
    private slots:
 
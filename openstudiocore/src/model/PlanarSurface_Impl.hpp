@@ -39,6 +39,8 @@
 
 namespace openstudio {
 
+class PolygonBatch;
+
 namespace model {
 
 class PlanarSurfaceGroup;
@@ -172,12 +174,23 @@ namespace detail {
 
     Point3d centroid() const;
 
+    /// Stores the gross area and outward normal of polygon index of batch, computed from vertices(), in the cached geometry.
+    void setCachedGeometry(const PolygonBatch& batch, unsigned index) const;
+
     std::vector<ModelObject> solarCollectors() const;
 
     std::vector<GeneratorPhotovoltaic> generatorPhotovoltaics() const;
     
     std::vector<SurfacePropertyConvectionCoefficients> surfacePropertyConvectionCoefficients() const;
 
+    //@}
+    /** @name Signal Helpers */
+    //@{
+
+    /** Clears cached geometry, then emits signals. Cached geometry is cleared even while a
+     *  Workspace edit transaction holds the signals back. */
+    virtual void emitChangeSignals() override;
+
     //@}
    protected:
 
@@ -199,6 +212,7 @@ namespace detail {
     mutable boost::optional<std::vector<Point3d> > m_cachedVertices;
     mutable boost::optional<Plane> m_cachedPlane;
     mutable boost::optional<Vector3d> m_cachedOutwardNormal;
+    mutable boost::optional<double> m_cachedGrossArea;
     mutable std::vector<std::vector<Point3d> > m_cachedTriangulation;
 
   };
@@ -415,6 +415,12 @@ namespace detail {
     return true;
   }
 
+  void ScheduleDay_Impl::emitChangeSignals()
+  {
+    clearCachedVariables();
+    ScheduleBase_Impl::emitChangeSignals();
+  }
+
   void ScheduleDay_Impl::clearCachedVariables()
   {
     m_cachedTimes.reset();
@@ -130,6 +130,14 @@ namespace detail {
     // ensure that this object does not contain the date 2/29
     virtual void ensureNoLeapDays() override;
 
+    //@}
+    /** @name Signal Helpers */
+    //@{
+
+    /** Clears cached times and values, then emits signals. The cache is cleared even while a
+     *  Workspace edit transaction holds the signals back. */
+    virtual void emitChangeSignals() override;
+
     //@}
    protected:
     virtual bool candidateIsCompatibleWithCurrentUse(const ScheduleTypeLimits& candidate) const override;
@@ -138,6 +138,32 @@ namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // keys of the Space metrics cached by Model_Impl::cachedMetric
+    const std::string floorAreaMetric("floorArea");
+    const std::string exteriorAreaMetric("exteriorArea");
+    const std::string exteriorWallAreaMetric("exteriorWallArea");
+    const std::string volumeMetric("volume");
+    const std::string numberOfPeopleMetric("numberOfPeople");
+    const std::string peoplePerFloorAreaMetric("peoplePerFloorArea");
+    const std::string lightingPowerMetric("lightingPower");
+    const std::string lightingPowerPerFloorAreaMetric("lightingPowerPerFloorArea");
+    const std::string lightingPowerPerPersonMetric("lightingPowerPerPerson");
+    const std::string electricEquipmentPowerMetric("electricEquipmentPower");
+    const std::string electricEquipmentPowerPerFloorAreaMetric("electricEquipmentPowerPerFloorArea");
+    const std::string electricEquipmentPowerPerPersonMetric("electricEquipmentPowerPerPerson");
+    const std::string gasEquipmentPowerMetric("gasEquipmentPower");
+    const std::string gasEquipmentPowerPerFloorAreaMetric("gasEquipmentPowerPerFloorArea");
+    const std::string gasEquipmentPowerPerPersonMetric("gasEquipmentPowerPerPerson");
+    const std::string infiltrationDesignFlowRateMetric("infiltrationDesignFlowRate");
+    const std::string infiltrationDesignFlowPerSpaceFloorAreaMetric("infiltrationDesignFlowPerSpaceFloorArea");
+    const std::string infiltrationDesignFlowPerExteriorSurfaceAreaMetric("infiltrationDesignFlowPerExteriorSurfaceArea");
+    const std::string infiltrationDesignFlowPerExteriorWallAreaMetric("infiltrationDesignFlowPerExteriorWallArea");
+    const std::string infiltrationDesignAirChangesPerHourMetric("infiltrationDesignAirChangesPerHour");
+
+  } // anonymous
+
   Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle)
   {
@@ -896,90 +922,98 @@ namespace detail {
 
   double Space_Impl::floorArea() const
   {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor"))
-      {
-        if (surface.isAirWall()){
-          continue;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), floorAreaMetric, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor"))
+        {
+          if (surface.isAirWall()){
+            continue;
+          }
+          result += surface.grossArea();
         }
-        result += surface.grossArea();
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::exteriorArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        result += surface.grossArea();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), exteriorAreaMetric, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
+        {
+          result += surface.grossArea();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::exteriorWallArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        if (istringEqual(surface.surfaceType(), "Wall"))
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), exteriorWallAreaMetric, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
         {
-          result += surface.grossArea();
+          if (istringEqual(surface.surfaceType(), "Wall"))
+          {
+            result += surface.grossArea();
+          }
         }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Space_Impl::volume() const {
-    double result = 0;
-
-    // TODO: need a better method
-    double roofHeight = 0;
-    int numRoof = 0;
-    double floorHeight = 0;
-    int numFloor = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor")){
-        for (const Point3d& point : surface.vertices()) {
-          floorHeight += point.z();
-          ++numFloor;
-        }
-      }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
-        for (const Point3d& point : surface.vertices()) {
-          roofHeight += point.z();
-          ++numRoof;
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), volumeMetric, [this]() {
+      double result = 0;
+
+      // TODO: need a better method
+      double roofHeight = 0;
+      int numRoof = 0;
+      double floorHeight = 0;
+      int numFloor = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor")){
+          for (const Point3d& point : surface.vertices()) {
+            floorHeight += point.z();
+            ++numFloor;
+          }
+        }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
+          for (const Point3d& point : surface.vertices()) {
+            roofHeight += point.z();
+            ++numRoof;
+          }
         }
       }
-    }
 
-    if ((numRoof > 0) * (numFloor > 0)){
-      roofHeight /= numRoof;
-      floorHeight /= numFloor;
-      result = (roofHeight - floorHeight) * this->floorArea();
-    }
-
-    return result;
+      if ((numRoof > 0) * (numFloor > 0)){
+        roofHeight /= numRoof;
+        floorHeight /= numFloor;
+        result = (roofHeight - floorHeight) * this->floorArea();
+      }
+      return result;
+    });
   }
 
   double Space_Impl::numberOfPeople() const {
-    double result = 0.0;
-    double area = floorArea();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), numberOfPeopleMetric, [this]() {
+      double result = 0.0;
+      double area = floorArea();
 
-    for (const People& person : this->people()) {
-      result += person.getNumberOfPeople(area);
-    }
-
-    if (OptionalSpaceType st = spaceType()){
-      for (const People& person : st->people()) {
+      for (const People& person : this->people()) {
         result += person.getNumberOfPeople(area);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()){
+        for (const People& person : st->people()) {
+          result += person.getNumberOfPeople(area);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1044,20 +1078,21 @@ namespace detail {
 
 
   double Space_Impl::peoplePerFloorArea() const {
-    double result = 0.0;
-    double area = floorArea();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), peoplePerFloorAreaMetric, [this]() {
+      double result = 0.0;
+      double area = floorArea();
 
-    for (const People& person : this->people()) {
-      result += person.getPeoplePerFloorArea(area);
-    }
-
-    if (OptionalSpaceType st = spaceType()){
-      for (const People& person : st->people()) {
+      for (const People& person : this->people()) {
         result += person.getPeoplePerFloorArea(area);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()){
+        for (const People& person : st->people()) {
+          result += person.getPeoplePerFloorArea(area);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setPeoplePerFloorArea(double peoplePerFloorArea) {
@@ -1187,27 +1222,28 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const Lights& light : lights()) {
-      result += light.getLightingPower(area,numPeople);
-    }
-    for (const Luminaire& luminaire : luminaires()) {
-      result += luminaire.lightingPower();
-    }
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), lightingPowerMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const Lights& light : spaceType->lights()) {
+      for (const Lights& light : lights()) {
         result += light.getLightingPower(area,numPeople);
       }
-      for (const Luminaire& luminaire : spaceType->luminaires()) {
+      for (const Luminaire& luminaire : luminaires()) {
         result += luminaire.lightingPower();
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const Lights& light : spaceType->lights()) {
+          result += light.getLightingPower(area,numPeople);
+        }
+        for (const Luminaire& luminaire : spaceType->luminaires()) {
+          result += luminaire.lightingPower();
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1280,27 +1316,28 @@ namespace detail {
   }
 
   double Space_Impl::lightingPowerPerFloorArea() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), lightingPowerPerFloorAreaMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    for (const Lights& light : lights()) {
-      result += light.getPowerPerFloorArea(area,numPeople);
-    }
-    for (const Luminaire& luminaire : luminaires()) {
-      result += luminaire.getPowerPerFloorArea(area);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const Lights& light : spaceType->lights()) {
+      for (const Lights& light : lights()) {
         result += light.getPowerPerFloorArea(area,numPeople);
       }
-      for (const Luminaire& luminaire : spaceType->luminaires()) {
+      for (const Luminaire& luminaire : luminaires()) {
         result += luminaire.getPowerPerFloorArea(area);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const Lights& light : spaceType->lights()) {
+          result += light.getPowerPerFloorArea(area,numPeople);
+        }
+        for (const Luminaire& luminaire : spaceType->luminaires()) {
+          result += luminaire.getPowerPerFloorArea(area);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setLightingPowerPerFloorArea(double lightingPowerPerFloorArea) {
@@ -1374,27 +1411,28 @@ namespace detail {
   }
 
   double Space_Impl::lightingPowerPerPerson() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), lightingPowerPerPersonMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    for (const Lights& light : lights()) {
-      result += light.getPowerPerPerson(area,numPeople);
-    }
-    for (const Luminaire& luminaire : luminaires()) {
-      result += luminaire.getPowerPerPerson(numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const Lights& light : spaceType->lights()) {
+      for (const Lights& light : lights()) {
         result += light.getPowerPerPerson(area,numPeople);
       }
-      for (const Luminaire& luminaire : spaceType->luminaires()) {
+      for (const Luminaire& luminaire : luminaires()) {
         result += luminaire.getPowerPerPerson(numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const Lights& light : spaceType->lights()) {
+          result += light.getPowerPerPerson(area,numPeople);
+        }
+        for (const Luminaire& luminaire : spaceType->luminaires()) {
+          result += luminaire.getPowerPerPerson(numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setLightingPowerPerPerson(double lightingPowerPerPerson) {
@@ -1468,21 +1506,22 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), electricEquipmentPowerMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    for (const ElectricEquipment& equipment : electricEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+      for (const ElectricEquipment& equipment : electricEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setElectricEquipmentPower(double electricEquipmentPower) {
@@ -1549,21 +1588,22 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPowerPerFloorArea() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const ElectricEquipment& equipment : electricEquipment()) {
-      result += equipment.getPowerPerFloorArea(area,numPeople);
-    }
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), electricEquipmentPowerPerFloorAreaMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+      for (const ElectricEquipment& equipment : electricEquipment()) {
         result += equipment.getPowerPerFloorArea(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+          result += equipment.getPowerPerFloorArea(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setElectricEquipmentPowerPerFloorArea(double electricEquipmentPowerPerFloorArea)
@@ -1631,21 +1671,22 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPowerPerPerson() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const ElectricEquipment& equipment : electricEquipment()) {
-      result += equipment.getPowerPerPerson(area,numPeople);
-    }
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), electricEquipmentPowerPerPersonMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+      for (const ElectricEquipment& equipment : electricEquipment()) {
         result += equipment.getPowerPerPerson(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+          result += equipment.getPowerPerPerson(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setElectricEquipmentPowerPerPerson(double electricEquipmentPowerPerPerson) {
@@ -1713,21 +1754,22 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const GasEquipment& equipment : gasEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), gasEquipmentPowerMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+      for (const GasEquipment& equipment : gasEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -1794,21 +1836,22 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPowerPerFloorArea() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const GasEquipment& equipment : gasEquipment()) {
-      result += equipment.getPowerPerFloorArea(area,numPeople);
-    }
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), gasEquipmentPowerPerFloorAreaMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+      for (const GasEquipment& equipment : gasEquipment()) {
         result += equipment.getPowerPerFloorArea(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+          result += equipment.getPowerPerFloorArea(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setGasEquipmentPowerPerFloorArea(double gasEquipmentPowerPerFloorArea)
@@ -1876,21 +1919,22 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPowerPerPerson() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), gasEquipmentPowerPerPersonMetric, [this]() {
+      double result(0.0);
+      double area = floorArea();
+      double numPeople = numberOfPeople();
 
-    for (const GasEquipment& equipment : gasEquipment()) {
-      result += equipment.getPowerPerPerson(area,numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+      for (const GasEquipment& equipment : gasEquipment()) {
         result += equipment.getPowerPerPerson(area,numPeople);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+          result += equipment.getPowerPerPerson(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setGasEquipmentPowerPerPerson(double gasEquipmentPowerPerPerson) {
@@ -1958,133 +2002,138 @@ namespace detail {
   }
 
   double Space_Impl::infiltrationDesignFlowRate() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getDesignFlowRate(floorArea,
-                                       exteriorSurfaceArea,
-                                       exteriorWallArea,
-                                       airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignFlowRateMetric, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getDesignFlowRate(floorArea,
                                          exteriorSurfaceArea,
                                          exteriorWallArea,
                                          airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getDesignFlowRate(floorArea,
+                                           exteriorSurfaceArea,
+                                           exteriorWallArea,
+                                           airVolume);
+        }
+      }
+      return result;
+    });
   }
 
   double Space_Impl::infiltrationDesignFlowPerSpaceFloorArea() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getFlowPerSpaceFloorArea(floorArea,
-                                              exteriorSurfaceArea,
-                                              exteriorWallArea,
-                                              airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignFlowPerSpaceFloorAreaMetric, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getFlowPerSpaceFloorArea(floorArea,
                                                 exteriorSurfaceArea,
                                                 exteriorWallArea,
                                                 airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getFlowPerSpaceFloorArea(floorArea,
+                                                  exteriorSurfaceArea,
+                                                  exteriorWallArea,
+                                                  airVolume);
+        }
+      }
+      return result;
+    });
   }
 
   double Space_Impl::infiltrationDesignFlowPerExteriorSurfaceArea() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getFlowPerExteriorSurfaceArea(floorArea,
-                                                   exteriorSurfaceArea,
-                                                   exteriorWallArea,
-                                                   airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignFlowPerExteriorSurfaceAreaMetric, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getFlowPerExteriorSurfaceArea(floorArea,
                                                      exteriorSurfaceArea,
                                                      exteriorWallArea,
                                                      airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getFlowPerExteriorSurfaceArea(floorArea,
+                                                       exteriorSurfaceArea,
+                                                       exteriorWallArea,
+                                                       airVolume);
+        }
+      }
+      return result;
+    });
   }
 
   double Space_Impl::infiltrationDesignFlowPerExteriorWallArea() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getFlowPerExteriorWallArea(floorArea,
-                                                exteriorSurfaceArea,
-                                                exteriorWallArea,
-                                                airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignFlowPerExteriorWallAreaMetric, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getFlowPerExteriorWallArea(floorArea,
                                                   exteriorSurfaceArea,
                                                   exteriorWallArea,
                                                   airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getFlowPerExteriorWallArea(floorArea,
+                                                    exteriorSurfaceArea,
+                                                    exteriorWallArea,
+                                                    airVolume);
+        }
+      }
+      return result;
+    });
   }
 
   double Space_Impl::infiltrationDesignAirChangesPerHour() const {
-    double result(0.0);
-    double floorArea = this->floorArea();
-    double exteriorSurfaceArea = this->exteriorArea();
-    double exteriorWallArea = this->exteriorWallArea();
-    double airVolume = volume();
-
-    for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
-      result += idfr.getAirChangesPerHour(floorArea,
-                                          exteriorSurfaceArea,
-                                          exteriorWallArea,
-                                          airVolume);
-    }
-
-    if (OptionalSpaceType st = spaceType()) {
-      for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+    return model().getImpl<Model_Impl>()->cachedMetric(handle(), infiltrationDesignAirChangesPerHourMetric, [this]() {
+      double result(0.0);
+      double floorArea = this->floorArea();
+      double exteriorSurfaceArea = this->exteriorArea();
+      double exteriorWallArea = this->exteriorWallArea();
+      double airVolume = volume();
+
+      for (const SpaceInfiltrationDesignFlowRate& idfr : spaceInfiltrationDesignFlowRates()) {
         result += idfr.getAirChangesPerHour(floorArea,
                                             exteriorSurfaceArea,
                                             exteriorWallArea,
                                             airVolume);
       }
-    }
 
-    return result;
+      if (OptionalSpaceType st = spaceType()) {
+        for (const SpaceInfiltrationDesignFlowRate& idfr : st->spaceInfiltrationDesignFlowRates()) {
+          result += idfr.getAirChangesPerHour(floorArea,
+                                              exteriorSurfaceArea,
+                                              exteriorWallArea,
+                                              airVolume);
+        }
+      }
+      return result;
+    });
   }
 
   void Space_Impl::hardApplySpaceType(bool hardSizeLoads)
@@ -589,27 +589,16 @@ namespace detail {
       OptionalDouble outputResult;
       // opaque exterior
       if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + 
-            to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
-        if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor with Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+        OptionalString rowName = sqlFile->tabularDataRowName("EnvelopeSummary", "Entire Facility", "Opaque Exterior", std::string("Construction"), to_upper_copy(*constructionName));
+        if (rowName) {
+          outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowName, "U-Factor with Film", "W/m2-K");
         }
       }
       // fenestration
       if (sqlFile && constructionName && oConstruction->isFenestration()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
-        if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+        OptionalString rowName = sqlFile->tabularDataRowName("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", std::string("Construction"), to_upper_copy(*constructionName));
+        if (rowName) {
+          outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowName, "Glass U-Factor", "W/m2-K");
         }
       }
 
@@ -639,27 +628,17 @@ namespace detail {
       OptionalDouble outputResult;
       // opaque exterior
       if (sqlFile && constructionName && oConstruction->isOpaque()) {
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
-        if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' AND ReportForString='Entire Facility' AND TableName='Opaque Exterior' AND RowId='";
-          ss << *rowId << "' AND ColumnName='U-Factor no Film' AND Units='W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+        OptionalString rowName = sqlFile->tabularDataRowName("EnvelopeSummary", "Entire Facility", "Opaque Exterior", std::string("Construction"), to_upper_copy(*constructionName));
+        if (rowName) {
+          outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Opaque Exterior", *rowName, "U-Factor no Film", "W/m2-K");
         }
       }
       // fenestration
       if (sqlFile && constructionName && oConstruction->isFenestration()) {
         // get u-factor, then subtract film coefficients
-        std::string query = "SELECT RowId FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND ColumnName='Construction' AND Value='" + to_upper_copy(*constructionName) + "'";
-        OptionalInt rowId = sqlFile->execAndReturnFirstInt(query);
-        if (rowId) {
-          std::stringstream ss;
-          ss << "SELECT Value FROM tabulardatawithstrings WHERE ReportName='EnvelopeSummary' and ReportForString = 'Entire Facility' AND TableName = 'Exterior Fenestration' AND RowId='";
-          ss << *rowId << "' AND ColumnName ='Glass U-Factor' AND Units = 'W/m2-K'";
-          query = ss.str();
-          outputResult = sqlFile->execAndReturnFirstDouble(query);
+        OptionalString rowName = sqlFile->tabularDataRowName("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", std::string("Construction"), to_upper_copy(*constructionName));
+        if (rowName) {
+          outputResult = sqlFile->tabularDataValue("EnvelopeSummary", "Entire Facility", "Exterior Fenestration", *rowName, "Glass U-Factor", "W/m2-K");
         }
         if (outputResult) {
           outputResult = 1.0/(1.0/(*outputResult) - filmResistance());
@@ -952,9 +952,9 @@ namespace detail {
     // TODO: this should not require sql file
 
     if (mySqlFile) {
-      // now use sql query to check if conditioned
+      // now use tabular report to check if conditioned
       std::string zoneName = boost::to_upper_copy(name(true).get());
-      result = mySqlFile->execAndReturnFirstString("SELECT Value from tabulardatawithstrings where (reportname = 'InputVerificationandResultsSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Zone Summary'  ) and (ColumnName ='Conditioned (Y/N)') and (RowName = '" + zoneName + "')");
+      result = mySqlFile->tabularDataString("InputVerificationandResultsSummary", "Entire Facility", "Zone Summary", zoneName, "Conditioned (Y/N)");
       if (!result){
         LOG(Error, "Query for " << briefDescription() << " isConditioned failed.");
       }
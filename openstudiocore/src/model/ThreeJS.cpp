@@ -396,42 +396,36 @@ namespace openstudio
       }
     }
 
-    void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    // get the vertices of a surface and all its sub surfaces in face coordinates, t transforms face coordinates to surface coordinates
+    void getFaceVertices(const PlanarSurface& planarSurface, Transformation& t, Point3dVector& faceVertices, Point3dVectorVector& faceSubVertices)
     {
-      std::string name = planarSurface.nameString();
       boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
-      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
-
-      // get the transformation to site coordinates
-      Transformation siteTransformation;
-      if (planarSurfaceGroup){
-        siteTransformation = planarSurfaceGroup->siteTransformation();
-      }
 
       // get the vertices
       Point3dVector vertices = planarSurface.vertices();
-      Transformation t = Transformation::alignFace(vertices);
+      t = Transformation::alignFace(vertices);
       //Transformation r = t.rotationMatrix();
       Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv*vertices);
+      faceVertices = reverse(tInv*vertices);
 
       // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
+      faceSubVertices.clear();
       if (surface){
         for (const auto& subSurface : surface->subSurfaces()){
           faceSubVertices.push_back(reverse(tInv*subSurface.vertices()));
         }
       }
+    }
 
-      Point3dVectorVector finalFaceVertices;
-      if (triangulateSurfaces){
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
-        if (finalFaceVertices.empty()){
-          LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
-          return;
-        }
-      } else{
-        finalFaceVertices.push_back(faceVertices);
+    // finalFaceVertices are the faces to draw in face coordinates, either the triangulation of the surface or its face vertices
+    void makeGeometries(const PlanarSurface& planarSurface, const Transformation& t, const Point3dVectorVector& finalFaceVertices, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces)
+    {
+      boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+
+      // get the transformation to site coordinates
+      Transformation siteTransformation;
+      if (planarSurfaceGroup){
+        siteTransformation = planarSurfaceGroup->siteTransformation();
       }
 
       Point3dVector allVertices;
@@ -487,7 +481,7 @@ namespace openstudio
         }
 
         Point3dVector otherVertices = otherSiteTransformation*adjacentPlanarSurface->vertices();
-        if (circularEqual(siteTransformation*vertices, reverse(otherVertices))){
+        if (circularEqual(siteTransformation*planarSurface.vertices(), reverse(otherVertices))){
           userData.setCoincidentWithOutsideObject(true); 
         } else{
           userData.setCoincidentWithOutsideObject(false); 
@@ -506,12 +500,42 @@ namespace openstudio
       std::vector<ThreeSceneChild> sceneChildren;
       std::vector<ThreeGeometry> allGeometries;
 
+      std::vector<PlanarSurface> planarSurfaces = model.getModelObjects<PlanarSurface>();
+
+      // get the face vertices of all surfaces
+      size_t numSurfaces = planarSurfaces.size();
+      std::vector<Transformation> transformations(numSurfaces);
+      Point3dVectorVector allFaceVertices(numSurfaces);
+      std::vector<Point3dVectorVector> allFaceSubVertices(numSurfaces);
+      for (size_t i = 0; i < numSurfaces; ++i){
+        getFaceVertices(planarSurfaces[i], transformations[i], allFaceVertices[i], allFaceSubVertices[i]);
+      }
+
+      // triangulate all surfaces in parallel up front
+      std::vector<Point3dVectorVector> allTriangulations;
+      if (triangulateSurfaces){
+        allTriangulations = computeTriangulations(allFaceVertices, allFaceSubVertices);
+      }
+
       // loop over all surfaces
-      for (const auto& planarSurface : model.getModelObjects<PlanarSurface>())
+      for (size_t i = 0; i < numSurfaces; ++i)
       {
+        const PlanarSurface& planarSurface = planarSurfaces[i];
+
+        Point3dVectorVector finalFaceVertices;
+        if (triangulateSurfaces){
+          finalFaceVertices = allTriangulations[i];
+          if (finalFaceVertices.empty()){
+            LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << planarSurface.nameString() << " with " << allFaceSubVertices[i].size() << " sub surfaces");
+            continue;
+          }
+        } else{
+          finalFaceVertices.push_back(allFaceVertices[i]);
+        }
+
         std::vector<ThreeGeometry> geometries;
         std::vector<ThreeUserData> userDatas;
-        makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces);
+        makeGeometries(planarSurface, transformations[i], finalFaceVertices, geometries, userDatas, triangulateSurfaces);
         OS_ASSERT(geometries.size() == userDatas.size());
 
         size_t n = geometries.size();
@@ -31,9 +31,15 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Surface.hpp"
+#include "../Space.hpp"
+#include "../Model.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Vector3d.hpp"
+#include "../../utilities/geometry/PolygonBatch.hpp"
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -86,3 +92,77 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions)
   EXPECT_NEAR(qc->value(),PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph),1.0E-8);
 }
 
+TEST_F(ModelFixture, PlanarSurface_EditTransaction)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 1));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(1, 0, 0));
+  points.push_back(Point3d(1, 0, 1));
+  Surface surface(points, model);
+  EXPECT_NEAR(1.0, surface.grossArea(), 1.0E-8);
+
+  {
+    WorkspaceEditTransaction transaction(model);
+
+    points.clear();
+    points.push_back(Point3d(0, 0, 1));
+    points.push_back(Point3d(0, 0, 0));
+    points.push_back(Point3d(2, 0, 0));
+    points.push_back(Point3d(2, 0, 1));
+    EXPECT_TRUE(surface.setVertices(points));
+
+    // cached geometry is cleared although the change signals are held
+    EXPECT_NEAR(2.0, surface.grossArea(), 1.0E-8);
+  }
+
+  EXPECT_NEAR(2.0, surface.grossArea(), 1.0E-8);
+}
+
+TEST_F(ModelFixture, PlanarSurface_ComputeGeometry)
+{
+  Model model;
+
+  Point3dVector floorPrint;
+  floorPrint.push_back(Point3d(0, 10, 0));
+  floorPrint.push_back(Point3d(10, 10, 0));
+  floorPrint.push_back(Point3d(10, 0, 0));
+  floorPrint.push_back(Point3d(0, 0, 0));
+
+  boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+  ASSERT_TRUE(space);
+
+  std::vector<PlanarSurface> planarSurfaces;
+  for (const Surface& surface : space->surfaces()){
+    planarSurfaces.push_back(surface);
+  }
+  ASSERT_EQ(6u, planarSurfaces.size());
+
+  PolygonBatch geometry = PlanarSurface::computeGeometry(planarSurfaces);
+  ASSERT_EQ(6u, geometry.numPolygons());
+
+  for (unsigned i = 0; i < planarSurfaces.size(); ++i){
+    EXPECT_EQ(planarSurfaces[i].grossArea(), geometry.areas()[i]);
+    EXPECT_EQ(planarSurfaces[i].outwardNormal().x(), geometry.outwardNormal(i)->x());
+    EXPECT_EQ(planarSurfaces[i].outwardNormal().y(), geometry.outwardNormal(i)->y());
+    EXPECT_EQ(planarSurfaces[i].outwardNormal().z(), geometry.outwardNormal(i)->z());
+    EXPECT_NEAR(planarSurfaces[i].tilt(), geometry.tilts()[i], 1.0E-8);
+    EXPECT_NEAR(planarSurfaces[i].azimuth(), geometry.azimuths()[i], 1.0E-8);
+    ASSERT_TRUE(geometry.centroid(i));
+    EXPECT_NEAR(planarSurfaces[i].centroid().x(), geometry.centroid(i)->x(), 1.0E-8);
+    EXPECT_NEAR(planarSurfaces[i].centroid().y(), geometry.centroid(i)->y(), 1.0E-8);
+    EXPECT_NEAR(planarSurfaces[i].centroid().z(), geometry.centroid(i)->z(), 1.0E-8);
+  }
+
+  // cached geometry is cleared when the vertices change
+  Surface surface = space->surfaces()[0];
+  Point3dVector vertices = surface.vertices();
+  double area = surface.grossArea();
+  for (Point3d& vertex : vertices){
+    vertex = Point3d(2*vertex.x(), 2*vertex.y(), 2*vertex.z());
+  }
+  EXPECT_TRUE(surface.setVertices(vertices));
+  EXPECT_NEAR(4*area, surface.grossArea(), 1.0E-8);
+}
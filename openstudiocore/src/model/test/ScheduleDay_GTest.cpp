@@ -36,6 +36,7 @@
 
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
+#include "../../utilities/idf/Workspace.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -334,3 +335,34 @@ TEST_F(ModelFixture, Schedule_Day_Clone)
   EXPECT_EQ(limits.handle(), daySchedule.scheduleTypeLimits()->handle());
   EXPECT_EQ(daySchedule.scheduleTypeLimits()->handle(), daySchedule2.scheduleTypeLimits()->handle());
 }
+
+TEST_F(ModelFixture, Schedule_Day_EditTransaction)
+{
+  Model model;
+  ScheduleDay daySchedule(model);
+
+  {
+    WorkspaceEditTransaction transaction(model);
+
+    // each value is inserted using times cached before the previous addValue
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 8, 0), 1.0));
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 17, 0), 2.0));
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 12, 0), 3.0));
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 8, 0), 4.0));
+
+    ASSERT_EQ(4u, daySchedule.times().size());
+    EXPECT_EQ(Time(0, 8, 0), daySchedule.times()[0]);
+    EXPECT_EQ(Time(0, 12, 0), daySchedule.times()[1]);
+    EXPECT_EQ(Time(0, 17, 0), daySchedule.times()[2]);
+    EXPECT_EQ(Time(0, 24, 0), daySchedule.times()[3]);
+    ASSERT_EQ(4u, daySchedule.values().size());
+    EXPECT_EQ(4.0, daySchedule.values()[0]);
+    EXPECT_EQ(3.0, daySchedule.values()[1]);
+    EXPECT_EQ(2.0, daySchedule.values()[2]);
+    EXPECT_EQ(0.0, daySchedule.values()[3]);
+  }
+
+  ASSERT_EQ(4u, daySchedule.times().size());
+  EXPECT_EQ(3.0, daySchedule.getValue(Time(0, 10, 0)));
+  EXPECT_EQ(2.0, daySchedule.getValue(Time(0, 15, 0)));
+}
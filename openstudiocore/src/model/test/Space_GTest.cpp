@@ -255,6 +255,79 @@ TEST_F(ModelFixture, Space_FloorArea)
   EXPECT_NEAR(6, space.floorArea(), 0.0001);
 }
 
+TEST_F(ModelFixture, Space_CachedMetrics)
+{
+  Model model;
+  Building building = model.getUniqueModelObject<Building>();
+  Space space(model);
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 1, 0));
+  points.push_back(Point3d(1, 1, 0));
+  points.push_back(Point3d(1, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  Surface floor(points, model);
+  floor.setParent(space);
+  EXPECT_EQ("Floor", floor.surfaceType());
+
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+  LightsDefinition definition(model);
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(10.0));
+  Lights lights(definition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+
+  EXPECT_NEAR(1, space.floorArea(), 0.0001);
+  EXPECT_NEAR(10, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(1, building.floorArea(), 0.0001);
+  EXPECT_NEAR(10, building.lightingPower(), 0.0001);
+
+  // repeated calls are served from the cache
+  unsigned long long changeCount = model.getImpl<detail::Model_Impl>()->changeCount();
+  EXPECT_NEAR(1, space.floorArea(), 0.0001);
+  EXPECT_NEAR(10, building.lightingPowerPerFloorArea(), 0.0001);
+  EXPECT_EQ(changeCount, model.getImpl<detail::Model_Impl>()->changeCount());
+
+  // changing the definition of a space type load
+  EXPECT_TRUE(definition.setWattsperSpaceFloorArea(20.0));
+  EXPECT_NEAR(20, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(20, building.lightingPower(), 0.0001);
+
+  // changing the geometry
+  points.clear();
+  points.push_back(Point3d(0, 2, 0));
+  points.push_back(Point3d(1, 2, 0));
+  points.push_back(Point3d(1, 0, 0));
+  points.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor.setVertices(points));
+  EXPECT_NEAR(2, space.floorArea(), 0.0001);
+  EXPECT_NEAR(40, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(2, building.floorArea(), 0.0001);
+  EXPECT_NEAR(40, building.lightingPower(), 0.0001);
+
+  // changes whose signals are held by an edit transaction
+  {
+    WorkspaceEditTransaction transaction(model);
+    EXPECT_TRUE(definition.setWattsperSpaceFloorArea(5.0));
+    EXPECT_NEAR(10, space.lightingPower(), 0.0001);
+    EXPECT_NEAR(10, building.lightingPower(), 0.0001);
+  }
+
+  // adding and removing objects
+  Space space2(model);
+  Surface floor2(points, model);
+  floor2.setParent(space2);
+  EXPECT_NEAR(4, building.floorArea(), 0.0001);
+  EXPECT_NEAR(10, building.lightingPower(), 0.0001);
+
+  space.resetSpaceType();
+  EXPECT_NEAR(0, space.lightingPower(), 0.0001);
+  EXPECT_NEAR(0, building.lightingPower(), 0.0001);
+
+  space2.remove();
+  EXPECT_NEAR(2, building.floorArea(), 0.0001);
+}
+
 TEST_F(ModelFixture, Space_Attributes) 
 {
   Model model;
@@ -29,6 +29,12 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
+#include "../utilities/core/UUID.hpp"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -39,6 +45,10 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/tokenizer.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -46,17 +56,123 @@ using namespace openstudio;
 namespace openstudio{
 namespace radiance{
 
+namespace {
+
+  // sidecar starts with the magic string, the format version, a marker to check byte order, a flag set once
+  // the file is complete, the grid and date time counts, the size and modification time in milliseconds of the
+  // source file, and the offset of the date times which are written after the values
+  const char sidecarMagic[8] = {'O', 'S', 'A', 'N', 'N', 'I', 'L', 'L'};
+  const uint32_t sidecarVersion = 2;
+  const uint32_t sidecarByteOrder = 0x01020304;
+  const std::streamoff sidecarHeaderSize = 56;
+
+  struct SidecarHeader
+  {
+    uint32_t complete;
+    uint32_t M;
+    uint32_t N;
+    uint32_t numDateTimes;
+    uint64_t sourceSize;
+    int64_t sourceTime;
+    uint64_t dateTimesOffset;
+  };
+
+  template <typename T>
+  void writeValue(std::ostream& os, const T& value)
+  {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  // read a value from the mapped sidecar at data and advance data, returns false if it would read past end
+  template <typename T>
+  bool readValue(const unsigned char*& data, const unsigned char* end, T& value)
+  {
+    if (static_cast<size_t>(end - data) < sizeof(T)){
+      return false;
+    }
+    std::memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    return true;
+  }
+
+  void writeHeader(std::ostream& os, const SidecarHeader& header)
+  {
+    os.seekp(0);
+    os.write(sidecarMagic, sizeof(sidecarMagic));
+    writeValue(os, sidecarVersion);
+    writeValue(os, sidecarByteOrder);
+    writeValue(os, header.complete);
+    writeValue(os, header.M);
+    writeValue(os, header.N);
+    writeValue(os, header.numDateTimes);
+    writeValue(os, header.sourceSize);
+    writeValue(os, header.sourceTime);
+    writeValue(os, header.dateTimesOffset);
+  }
+
+  bool readHeader(const unsigned char*& data, const unsigned char* end, SidecarHeader& header)
+  {
+    char magic[sizeof(sidecarMagic)];
+    if (!readValue(data, end, magic) || (std::memcmp(magic, sidecarMagic, sizeof(magic)) != 0)){
+      return false;
+    }
+    uint32_t version = 0;
+    uint32_t byteOrder = 0;
+    if (!readValue(data, end, version) || (version != sidecarVersion) || !readValue(data, end, byteOrder) || (byteOrder != sidecarByteOrder)){
+      return false;
+    }
+    return readValue(data, end, header.complete) && readValue(data, end, header.M) && readValue(data, end, header.N) &&
+           readValue(data, end, header.numDateTimes) && readValue(data, end, header.sourceSize) && readValue(data, end, header.sourceTime) &&
+           readValue(data, end, header.dateTimesOffset);
+  }
+
+  // modification time of the source file in milliseconds, one second resolution misses quick rewrites
+  int64_t modificationTime(const openstudio::path& path)
+  {
+    return QFileInfo(toQString(path)).lastModified().toMSecsSinceEpoch();
+  }
+
+  // month, day and hours as they appear in the file
+  struct SidecarDateTime
+  {
+    uint32_t month;
+    uint32_t day;
+    double hours;
+  };
+
+  DateTime toDateTime(const SidecarDateTime& sidecarDateTime)
+  {
+    MonthOfYear month = monthOfYear(sidecarDateTime.month);
+    double fracDays = sidecarDateTime.hours / 24.0;
+    return DateTime(Date(month, sidecarDateTime.day), Time(fracDays));
+  }
+
+  bool inHours(const DateTime& dateTime, double startHour, double endHour)
+  {
+    double hours = dateTime.time().totalHours();
+    return (hours >= startHour) && (hours < endHour);
+  }
+
+} // anonymous
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
+    : m_sidecarData(nullptr), m_valuesOffset(0)
   {}
 
   /// constructor with path
   AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::path& path)
+    : m_sidecarData(nullptr), m_valuesOffset(0)
   {
     init(path);
   }
 
-  void AnnualIlluminanceMap::init(const openstudio::path& path)
+  openstudio::path AnnualIlluminanceMap::sidecarPath(const openstudio::path& path)
+  {
+    return openstudio::toPath(openstudio::toString(path) + ".bin");
+  }
+
+  void AnnualIlluminanceMap::init(const openstudio::path& path, bool useSidecar)
   {
     // file must exist
     if (!exists( path )){
@@ -64,9 +180,36 @@ namespace radiance{
       return;
     }
 
+    // reuse the sidecar if the file has not changed since it was written
+    openstudio::path sidecar = sidecarPath(path);
+    if (useSidecar && mapSidecar(sidecar, path, true)){
+      return;
+    }
+
     // open file
     openstudio::filesystem::ifstream file(path);
 
+    // values are written to a uniquely named temporary sidecar which replaces any existing one when complete,
+    // maps which are using the existing one keep their open mapping of it
+    openstudio::path tempSidecar = openstudio::toPath(openstudio::toString(sidecar) + "." + removeBraces(createUUID()) + ".tmp");
+    std::fstream sidecarFile;
+    if (useSidecar){
+      sidecarFile.open(openstudio::toString(tempSidecar).c_str(), std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    }
+    if (useSidecar && !sidecarFile.is_open()){
+      LOG(Warn, "Cannot write '" << toString(tempSidecar) << "', illuminance values will be kept in memory");
+    }
+    std::vector<SidecarDateTime> sidecarDateTimes;
+
+    SidecarHeader header;
+    header.complete = 0;
+    header.M = 0;
+    header.N = 0;
+    header.numDateTimes = 0;
+    header.sourceSize = openstudio::filesystem::file_size(path);
+    header.sourceTime = modificationTime(path);
+    header.dateTimesOffset = 0;
+
     // keep track of line number
     unsigned lineNum = 0;
 
@@ -80,15 +223,12 @@ namespace radiance{
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
+    // values of one illuminance map, reused for each line
+    std::vector<double> values;
+
     // read the rest of the file line by line
     while(getline(file, line)){
       ++lineNum;
@@ -114,6 +254,20 @@ namespace radiance{
         M = m_xVector.size();
         N = m_yVector.size();
 
+        header.M = M;
+        header.N = N;
+
+        if (sidecarFile.is_open()){
+          writeHeader(sidecarFile, header);
+          for (unsigned i = 0; i < M; ++i){
+            writeValue(sidecarFile, m_xVector(i));
+          }
+          for (unsigned j = 0; j < N; ++j){
+            writeValue(sidecarFile, m_yVector(j));
+          }
+        }
+        m_valuesOffset = sidecarHeaderSize + sizeof(double)*(M + N);
+
       }else{
 
         // each line contains the month, day, time (in hours),
@@ -133,49 +287,295 @@ namespace radiance{
 
         if (numValues != M*N){
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
-          return;
+          break;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          SidecarDateTime sidecarDateTime;
+          sidecarDateTime.month = lexical_cast<unsigned>(lineVector[0]);
+          sidecarDateTime.day = lexical_cast<unsigned>(lineVector[1]);
+          sidecarDateTime.hours = lexical_cast<double>(lineVector[2]);
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
-          DateTime dateTime(Date(month, day), Time(fracDays));
-
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
+          DateTime dateTime = toDateTime(sidecarDateTime);
 
-          // read in the values
+          // read in the values, x varies fastest
+          values.resize(M*N);
           unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
+          for (unsigned k = 0; k < M*N; ++k){
+            values[k] = footcandlesToLux*lexical_cast<double>(lineVector[index]);
+            ++index;
           }
 
+          m_dateTimeIndices[dateTime] = m_dateTimes.size();
           m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
+          if (sidecarFile.is_open()){
+            sidecarDateTimes.push_back(sidecarDateTime);
+            sidecarFile.write(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(double));
+          }else{
+            m_values.push_back(values);
+          }
         }
       }
     }
 
     // close file
+    bool complete = file.eof();
     file.close();
+
+    if (!sidecarFile.is_open()){
+      return;
+    }
+
+    // date times go after the values
+    header.numDateTimes = sidecarDateTimes.size();
+    header.dateTimesOffset = static_cast<uint64_t>(m_valuesOffset + sizeof(double)*M*N*sidecarDateTimes.size());
+    sidecarFile.seekp(static_cast<std::streamoff>(header.dateTimesOffset));
+    for (const SidecarDateTime& sidecarDateTime : sidecarDateTimes){
+      writeValue(sidecarFile, sidecarDateTime.month);
+      writeValue(sidecarFile, sidecarDateTime.day);
+      writeValue(sidecarFile, sidecarDateTime.hours);
+    }
+
+    // a sidecar for a file which could not be read completely is still used for this map but never reused
+    header.complete = (complete && (lineNum >= 2)) ? 1 : 0;
+    writeHeader(sidecarFile, header);
+    sidecarFile.close();
+
+    if (!sidecarFile){
+      LOG(Warn, "Cannot write '" << toString(tempSidecar) << "', illuminance values will be kept in memory");
+      m_dateTimes.clear();
+      m_dateTimeIndices.clear();
+      openstudio::filesystem::remove(tempSidecar);
+      init(path, false);
+      return;
+    }
+
+    bool renamed = true;
+    try{
+      openstudio::filesystem::rename(tempSidecar, sidecar);
+    }catch(const std::exception&){
+      // the existing sidecar cannot be replaced while another map is using it on some platforms, map the temporary one
+      renamed = false;
+      sidecar = tempSidecar;
+    }
+
+    bool mapped = mapSidecar(sidecar, path, false);
+
+    if (!renamed){
+      // the temporary sidecar is never reused, remove it now, the mapping stays valid on platforms which allow
+      // removing open files, elsewhere the mapping is released first and the values are kept in memory
+      boost::system::error_code ec;
+      openstudio::filesystem::remove(tempSidecar, ec);
+      if (ec && mapped){
+        LOG(Warn, "Cannot remove '" << toString(tempSidecar) << "' while it is mapped, illuminance values will be kept in memory");
+        m_sidecar.reset();
+        m_sidecarData = nullptr;
+        openstudio::filesystem::remove(tempSidecar, ec);
+        m_dateTimes.clear();
+        m_dateTimeIndices.clear();
+        init(path, false);
+        return;
+      }
+    }
+
+    if (!mapped){
+      LOG(Warn, "Cannot map '" << toString(sidecar) << "', illuminance values will be kept in memory");
+      m_dateTimes.clear();
+      m_dateTimeIndices.clear();
+      init(path, false);
+    }
+  }
+
+  bool AnnualIlluminanceMap::mapSidecar(const openstudio::path& sidecar, const openstudio::path& path, bool reuse)
+  {
+    if (!openstudio::filesystem::is_regular_file(sidecar)){
+      return false;
+    }
+
+    // the file stays open and mapped for the lifetime of this map and its copies
+    std::shared_ptr<QFile> file = std::make_shared<QFile>(toQString(sidecar));
+    if (!file->open(QIODevice::ReadOnly)){
+      return false;
+    }
+    qint64 size = file->size();
+    if (size < sidecarHeaderSize){
+      return false;
+    }
+    const unsigned char* begin = file->map(0, size);
+    if (!begin){
+      return false;
+    }
+    const unsigned char* end = begin + size;
+    const unsigned char* data = begin;
+
+    SidecarHeader header;
+    if (!readHeader(data, end, header)){
+      return false;
+    }
+    if (reuse){
+      if ((header.complete != 1) || (header.sourceSize != openstudio::filesystem::file_size(path)) || (header.sourceTime != modificationTime(path))){
+        return false;
+      }
+    }
+
+    unsigned long long valuesOffset = sidecarHeaderSize + sizeof(double)*(header.M + header.N);
+    if (header.dateTimesOffset != valuesOffset + sizeof(double)*static_cast<uint64_t>(header.M)*header.N*header.numDateTimes){
+      return false;
+    }
+
+    openstudio::Vector xVector(header.M);
+    for (unsigned i = 0; i < header.M; ++i){
+      if (!readValue(data, end, xVector(i))){
+        return false;
+      }
+    }
+    openstudio::Vector yVector(header.N);
+    for (unsigned j = 0; j < header.N; ++j){
+      if (!readValue(data, end, yVector(j))){
+        return false;
+      }
+    }
+
+    if (header.dateTimesOffset > static_cast<uint64_t>(size)){
+      return false;
+    }
+    data = begin + header.dateTimesOffset;
+    openstudio::DateTimeVector dateTimes;
+    std::map<openstudio::DateTime, unsigned> dateTimeIndices;
+    for (unsigned t = 0; t < header.numDateTimes; ++t){
+      SidecarDateTime sidecarDateTime;
+      if (!readValue(data, end, sidecarDateTime.month) || !readValue(data, end, sidecarDateTime.day) || !readValue(data, end, sidecarDateTime.hours)){
+        return false;
+      }
+      DateTime dateTime = toDateTime(sidecarDateTime);
+      dateTimeIndices[dateTime] = dateTimes.size();
+      dateTimes.push_back(dateTime);
+    }
+
+    m_xVector = xVector;
+    m_yVector = yVector;
+    m_dateTimes = dateTimes;
+    m_dateTimeIndices = dateTimeIndices;
+    m_sidecar = file;
+    m_sidecarData = begin;
+    m_valuesOffset = valuesOffset;
+    m_values.clear();
+    return true;
+  }
+
+  boost::optional<unsigned> AnnualIlluminanceMap::dateTimeIndex(const openstudio::DateTime& dateTime) const
+  {
+    auto it = m_dateTimeIndices.find(dateTime);
+    if (it != m_dateTimeIndices.end()){
+      return it->second;
+    }
+    return boost::none;
+  }
+
+  const double* AnnualIlluminanceMap::values(unsigned t) const
+  {
+    if (m_sidecarData){
+      size_t numValues = m_xVector.size()*m_yVector.size();
+      return reinterpret_cast<const double*>(m_sidecarData + m_valuesOffset) + numValues*t;
+    }
+    return m_values[t].data();
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    boost::optional<unsigned> t = dateTimeIndex(dateTime);
+    if (!t){
+      return m_nullIlluminanceMap;
+    }
+
+    unsigned M = m_xVector.size();
+    unsigned N = m_yVector.size();
+
+    const double* v = values(*t);
+    Matrix result(M,N);
+    for (unsigned j = 0; j < N; ++j){
+      for (unsigned i = 0; i < M; ++i){
+        result(i,j) = v[j*M + i];
+      }
+    }
+    return result;
+  }
+
+  openstudio::Vector AnnualIlluminanceMap::illuminance(unsigned i, unsigned j) const
+  {
+    unsigned M = m_xVector.size();
+    unsigned N = m_yVector.size();
+    if ((i >= M) || (j >= N)){
+      LOG(Error, "Grid point (" << i << ", " << j << ") is outside the " << M << " by " << N << " illuminance map");
+      return openstudio::Vector();
+    }
+
+    unsigned k = j*M + i;
+    openstudio::Vector result(m_dateTimes.size());
+    for (unsigned t = 0; t < m_dateTimes.size(); ++t){
+      result(t) = values(t)[k];
+    }
+    return result;
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double threshold, double startHour, double endHour) const
+  {
+    return usefulDaylightIlluminance(threshold, std::numeric_limits<double>::infinity(), startHour, endHour);
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::usefulDaylightIlluminance(double lower, double upper, double startHour, double endHour) const
+  {
+    unsigned M = m_xVector.size();
+    unsigned N = m_yVector.size();
+
+    // count of hours in range for each point, in file order
+    std::vector<double> counts(M*N, 0.0);
+    unsigned numHours = 0;
+
+    for (unsigned t = 0; t < m_dateTimes.size(); ++t){
+      if (!inHours(m_dateTimes[t], startHour, endHour)){
+        continue;
+      }
+      ++numHours;
+      const double* v = values(t);
+      double* c = counts.data();
+      size_t n = counts.size();
+      for (size_t k = 0; k < n; ++k){
+        c[k] += ((v[k] >= lower) && (v[k] <= upper)) ? 1.0 : 0.0;
+      }
     }
 
-    return m_nullIlluminanceMap;
+    Matrix result(M, N, 0.0);
+    if (numHours == 0){
+      return result;
+    }
+    for (unsigned j = 0; j < N; ++j){
+      for (unsigned i = 0; i < M; ++i){
+        result(i,j) = counts[j*M + i] / numHours;
+      }
+    }
+    return result;
+  }
+
+  double AnnualIlluminanceMap::spatialDaylightAutonomy(double threshold, double fraction, double startHour, double endHour) const
+  {
+    Matrix da = daylightAutonomy(threshold, startHour, endHour);
+    if (da.size1() == 0 || da.size2() == 0){
+      return 0.0;
+    }
+
+    unsigned numPoints = 0;
+    for (unsigned i = 0; i < da.size1(); ++i){
+      for (unsigned j = 0; j < da.size2(); ++j){
+        if (da(i,j) >= fraction){
+          ++numPoints;
+        }
+      }
+    }
+    return static_cast<double>(numPoints) / (da.size1()*da.size2());
   }
 
 
@@ -37,20 +37,28 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <boost/optional.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+class QFile;
+
 namespace openstudio{
 namespace radiance{
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance 
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   When the file is parsed the values are written to a binary sidecar file next to it, see sidecarPath.
+  *   The sidecar is memory mapped for the lifetime of the map and illuminance values are read from the
+  *   mapping rather than kept in memory.  The sidecar is reused instead of parsing the file again as long
+  *   as the file does not change.  If the sidecar cannot be written or mapped the values are kept in memory.
   */ 
   class RADIANCE_API AnnualIlluminanceMap
   {
-    private:
-
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
-
     public:
 
       /// default constructor
@@ -75,17 +83,50 @@ namespace radiance{
       /// get the illuminance map in lux corresponding to date and time
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// get the illuminance in lux at grid point (i, j) for each of dateTimes, i indexes xVector and j indexes yVector
+      openstudio::Vector illuminance(unsigned i, unsigned j) const;
+
+      /// get the fraction of hours between startHour and endHour with illuminance of at least threshold lux, for each grid point
+      openstudio::Matrix daylightAutonomy(double threshold, double startHour = 8.0, double endHour = 18.0) const;
+
+      /// get the fraction of hours between startHour and endHour with illuminance from lower to upper lux, for each grid point
+      openstudio::Matrix usefulDaylightIlluminance(double lower = 100.0, double upper = 2000.0, double startHour = 8.0, double endHour = 18.0) const;
+
+      /// get the fraction of grid points which have a daylight autonomy of at least fraction for threshold lux, e.g. sDA300/50%
+      double spatialDaylightAutonomy(double threshold = 300.0, double fraction = 0.5, double startHour = 8.0, double endHour = 18.0) const;
+
+      /// get the path of the binary sidecar file used for the illuminance map at path
+      static openstudio::path sidecarPath(const openstudio::path& path);
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
-      void init(const openstudio::path& path);
+      // parse the file, values are kept in memory if useSidecar is false
+      void init(const openstudio::path& path, bool useSidecar = true);
+
+      // map the sidecar and read the grid and date times from it, if reuse it must be complete and match the file at path
+      bool mapSidecar(const openstudio::path& sidecar, const openstudio::path& path, bool reuse);
+
+      // index of dateTime in m_dateTimes
+      boost::optional<unsigned> dateTimeIndex(const openstudio::DateTime& dateTime) const;
+
+      // values for the date time with index t, in the same order as the file
+      const double* values(unsigned t) const;
 
       openstudio::DateTimeVector m_dateTimes;
+      std::map<openstudio::DateTime, unsigned> m_dateTimeIndices;
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+
+      // mapped sidecar file, values for each date time start at m_valuesOffset
+      std::shared_ptr<QFile> m_sidecar;
+      const unsigned char* m_sidecarData;
+      unsigned long long m_valuesOffset;
+
+      // values kept in memory if there is no sidecar
+      std::vector<std::vector<double> > m_values;
   };
 
 } // radiance
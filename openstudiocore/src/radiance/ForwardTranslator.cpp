@@ -121,7 +121,59 @@ using openstudio::model::OptionalShadingSurfaceGroup;
 using openstudio::model::OptionalInteriorPartitionSurfaceGroup;
 using openstudio::model::OptionalSurface;
 
-typedef openstudio::filesystem::basic_ofstream<char> OFSTREAM;
+// buffers the contents of an output file, on close the file is only written if the contents differ from the file
+// already on disk, this keeps the modification time of unchanged scene files during incremental translation
+class RadianceOutputFile : public std::ostringstream
+{
+public:
+
+  explicit RadianceOutputFile(const openstudio::path& p)
+    : m_path(p), m_open(false)
+  {
+    m_open = openstudio::filesystem::is_directory(p.parent_path()) && !openstudio::filesystem::is_directory(p);
+  }
+
+  ~RadianceOutputFile()
+  {
+    close();
+  }
+
+  bool is_open() const
+  {
+    return m_open;
+  }
+
+  void close()
+  {
+    if (!m_open){
+      return;
+    }
+    m_open = false;
+
+    std::string contents = str();
+
+    if (openstudio::filesystem::is_regular_file(m_path)){
+      openstudio::filesystem::ifstream existing(m_path);
+      std::string existingContents((std::istreambuf_iterator<char>(existing)), std::istreambuf_iterator<char>());
+      if (!existing.bad() && (existingContents == contents)){
+        return;
+      }
+    }
+
+    openstudio::filesystem::ofstream file(m_path);
+    file << contents;
+    if (!file){
+      LOG_FREE(Error, "openstudio.radiance.ForwardTranslator", "Cannot write file '" << openstudio::toString(m_path) << "'");
+    }
+  }
+
+private:
+
+  openstudio::path m_path;
+  bool m_open;
+};
+
+typedef RadianceOutputFile OFSTREAM;
 
 struct RadianceResourceInitializer{
   RadianceResourceInitializer() 
@@ -173,7 +225,8 @@ namespace radiance {
 
   // basic constructor
   ForwardTranslator::ForwardTranslator()
-    : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
+    : m_windowGroupId(1), // m_windowGroupId is reserved for uncontrolled
+      m_incrementalTranslation(false)
   {
     m_logSink.setLogLevel(Warn);
     m_logSink.setChannelRegex(boost::regex("openstudio\\.radiance\\.ForwardTranslator"));
@@ -288,7 +341,8 @@ namespace radiance {
 
       LOG(Debug, "Working Directory: " + openstudio::toString(outPath));
 
-      if (openstudio::filesystem::exists(outPath)){
+      // an incremental translation keeps the previous output, files are only written if they change
+      if (!m_incrementalTranslation && openstudio::filesystem::exists(outPath)){
         openstudio::filesystem::remove_all(outPath);
       }
 
@@ -457,6 +511,20 @@ namespace radiance {
         LOG(Error, "Cannot open file '" << toString(mapsoptpath) << "' for writing");
       }
 
+      // remove files written by the previous translation to outPath which were not written this time,
+      // other files in outPath are left alone
+      if (m_incrementalTranslation && (m_previousOutPath == outPath)){
+        std::set<openstudio::path> currentFiles(outfiles.begin(), outfiles.end());
+        for (const auto& previousFile : m_previousOutfiles){
+          if ((currentFiles.find(previousFile) == currentFiles.end()) && openstudio::filesystem::is_regular_file(previousFile)){
+            LOG(Debug, "Removing '" << toString(previousFile) << "' from previous translation");
+            openstudio::filesystem::remove(previousFile);
+          }
+        }
+      }
+      m_previousOutPath = outPath;
+      m_previousOutfiles = outfiles;
+
       // the end
       LOG(Debug, "Done. Radiance model located at: " << openstudio::toString(radDir) << ".");
 
@@ -469,6 +537,11 @@ namespace radiance {
     return outfiles;
   }
 
+  void ForwardTranslator::setIncrementalTranslation(bool incremental)
+  {
+    m_incrementalTranslation = incremental;
+  }
+
   std::vector<LogMessage> ForwardTranslator::warnings() const
   {
     std::vector<LogMessage> result;
@@ -858,6 +931,8 @@ namespace radiance {
     m_radWindowGroups.clear();
     m_radWindowGroupShades.clear();
 
+    m_windowGroups.clear();
+    m_windowGroupId = 1; // WG0 is reserved for uncontrolled windows
   }
 
   WindowGroup ForwardTranslator::getWindowGroup(const openstudio::Vector3d& outwardNormal, const model::Space& space, const model::ConstructionBase& construction,
@@ -1077,7 +1152,9 @@ namespace radiance {
   {
     std::vector<std::string> space_names;
 
-
+    // spaces are translated one after another: they read the model through the Workspace, which is not thread safe,
+    // and add to m_radMaterials and the window groups, so the fragment of a space depends on the spaces before it.
+    // unchanged fragments are skipped when their files are written, by comparing with the file already on disk
     for (const auto & space : t_spaces)
     {
       std::string space_name = cleanName(space.name().get());
@@ -1668,10 +1745,12 @@ namespace radiance {
 
 									openstudio::path shadeBSDFPath = t_radDir / openstudio::toPath("bsdf") / shadeBSDF;
 
-									if (!exists(shadeBSDFPath)){
-
-										// add BSDF file to the collection of crap to copy up
+									// add BSDF file to the collection of crap to copy up
+									if (std::find(t_outfiles.begin(), t_outfiles.end(), shadeBSDFPath) == t_outfiles.end()){
 										t_outfiles.push_back(shadeBSDFPath);
+									}
+
+									if (!exists(shadeBSDFPath)){
 
 										// read BSDF from resource dll
 										// must be referenced in openstudiocore/src/radiance/radiance.qrc
@@ -1699,10 +1778,12 @@ namespace radiance {
 
 								openstudio::path airBSDFPath = t_radDir / openstudio::toPath("bsdf") / openstudio::toPath("air.xml");
 
-								if (!exists(airBSDFPath)){
-
-									// add BSDF file to the collection of crap to copy up
+								// add BSDF file to the collection of crap to copy up
+								if (std::find(t_outfiles.begin(), t_outfiles.end(), airBSDFPath) == t_outfiles.end()){
 									t_outfiles.push_back(airBSDFPath);
+								}
+
+								if (!exists(airBSDFPath)){
 
 									// read BSDF from resource dll
 									// must be in openstudiocore/src/radiance/radiance.qrc
@@ -66,6 +66,13 @@ namespace radiance {
      */
     std::vector<openstudio::path> translateModel(const openstudio::path& outPath, const openstudio::model::Model& model);
 
+    /** If incremental, translateModel keeps the files in outPath from the previous translation. Each file
+     *  is only written if its contents change, so the scene files of unchanged spaces keep their modification
+     *  times. Files written by the previous translation to the same outPath which are no longer part of
+     *  the translation are removed, other files in outPath are left alone.
+     */
+    void setIncrementalTranslation(bool incremental);
+
     /** Get warning messages generated by the last translation.
      */
     std::vector<LogMessage> warnings() const;
@@ -152,6 +159,10 @@ namespace radiance {
       std::map<std::string, std::string> m_radWindowGroups;
       std::map<std::string, std::string> m_radWindowGroupShades;
       int m_windowGroupId;
+      bool m_incrementalTranslation;
+      // output of the previous translation, files which are no longer written are removed by an incremental translation
+      openstudio::path m_previousOutPath;
+      std::vector<openstudio::path> m_previousOutfiles;
       std::string shadeBSDF;
 
       // get window group
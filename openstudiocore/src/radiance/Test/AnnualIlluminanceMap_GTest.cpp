@@ -30,6 +30,8 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include <fstream>
+
 #include <resources.hxx>
 
 
@@ -79,3 +81,82 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Sidecar)
+{
+  // 2 by 2 grid with values in footcandles at 10:00, 12:00, and 20:00
+  openstudio::path path = toPath("./AnnualIlluminanceMap_Sidecar.ill");
+  openstudio::path sidecar = AnnualIlluminanceMap::sidecarPath(path);
+  openstudio::filesystem::remove(sidecar);
+  {
+    std::ofstream file(openstudio::toString(path).c_str());
+    file << "0 0 0 1 0 0 0 1 0" << std::endl;
+    file << "1 1 0" << std::endl;
+    file << "1 1 10.0 0 0 0 10 20 30 40" << std::endl;
+    file << "1 1 12.0 0 0 0 0 0 50 300" << std::endl;
+    file << "1 1 20.0 0 0 0 5 5 5 5" << std::endl;
+  }
+
+  AnnualIlluminanceMap map(path);
+  EXPECT_TRUE(openstudio::filesystem::exists(sidecar));
+  ASSERT_EQ(2u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(3u, map.dateTimes().size());
+
+  openstudio::Matrix illuminanceMap = map.illuminanceMap(map.dateTimes()[0]);
+  ASSERT_EQ(2u, illuminanceMap.size1());
+  ASSERT_EQ(2u, illuminanceMap.size2());
+  EXPECT_DOUBLE_EQ(10*10.76, illuminanceMap(0,0));
+  EXPECT_DOUBLE_EQ(20*10.76, illuminanceMap(1,0));
+  EXPECT_DOUBLE_EQ(30*10.76, illuminanceMap(0,1));
+  EXPECT_DOUBLE_EQ(40*10.76, illuminanceMap(1,1));
+
+  openstudio::Vector illuminance = map.illuminance(1,1);
+  ASSERT_EQ(3u, illuminance.size());
+  EXPECT_DOUBLE_EQ(40*10.76, illuminance(0));
+  EXPECT_DOUBLE_EQ(300*10.76, illuminance(1));
+  EXPECT_DOUBLE_EQ(5*10.76, illuminance(2));
+  EXPECT_EQ(0u, map.illuminance(2,0).size());
+
+  // 20:00 is outside of the default hours
+  openstudio::Matrix da = map.daylightAutonomy(300.0);
+  EXPECT_DOUBLE_EQ(0.0, da(0,0));
+  EXPECT_DOUBLE_EQ(0.0, da(1,0));
+  EXPECT_DOUBLE_EQ(1.0, da(0,1));
+  EXPECT_DOUBLE_EQ(1.0, da(1,1));
+
+  openstudio::Matrix udi = map.usefulDaylightIlluminance(100.0, 2000.0);
+  EXPECT_DOUBLE_EQ(0.5, udi(0,0));
+  EXPECT_DOUBLE_EQ(0.5, udi(1,0));
+  EXPECT_DOUBLE_EQ(1.0, udi(0,1));
+  EXPECT_DOUBLE_EQ(0.5, udi(1,1));
+
+  EXPECT_DOUBLE_EQ(0.5, map.spatialDaylightAutonomy(300.0, 0.5));
+
+  // sidecar is reused and gives the same values
+  AnnualIlluminanceMap map2(path);
+  ASSERT_EQ(3u, map2.dateTimes().size());
+  EXPECT_EQ(map.dateTimes()[1], map2.dateTimes()[1]);
+  openstudio::Matrix illuminanceMap2 = map2.illuminanceMap(map2.dateTimes()[1]);
+  ASSERT_EQ(2u, illuminanceMap2.size1());
+  EXPECT_DOUBLE_EQ(50*10.76, illuminanceMap2(0,1));
+  EXPECT_DOUBLE_EQ(300*10.76, illuminanceMap2(1,1));
+
+  // changing the file writes a new sidecar, maps using the old one keep their values
+  {
+    std::ofstream file(openstudio::toString(path).c_str());
+    file << "0 0 0 1 0 0 0 1 0" << std::endl;
+    file << "1 1 0" << std::endl;
+    file << "1 1 10.0 0 0 0 100 200 300 400" << std::endl;
+  }
+
+  AnnualIlluminanceMap map3(path);
+  ASSERT_EQ(1u, map3.dateTimes().size());
+  EXPECT_DOUBLE_EQ(400*10.76, map3.illuminance(1,1)(0));
+
+  illuminance = map.illuminance(1,1);
+  ASSERT_EQ(3u, illuminance.size());
+  EXPECT_DOUBLE_EQ(40*10.76, illuminance(0));
+  EXPECT_DOUBLE_EQ(300*10.76, illuminance(1));
+  EXPECT_DOUBLE_EQ(5*10.76, illuminance(2));
+  EXPECT_DOUBLE_EQ(300*10.76, map2.illuminanceMap(map2.dateTimes()[1])(1,1));
+}
@@ -54,6 +54,9 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <fstream>
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -201,6 +204,68 @@ TEST(Radiance, ForwardTranslator_ExampleModel)
 }
 
 
+TEST(Radiance, ForwardTranslator_ExampleModel_Incremental)
+{
+  Model model = exampleModel();
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModel_Incremental");
+  openstudio::filesystem::remove_all(outpath);
+  ASSERT_FALSE(openstudio::filesystem::exists(outpath));
+
+  ForwardTranslator ft;
+  ft.setIncrementalTranslation(true);
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  ASSERT_FALSE(outpaths.empty());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  // set all files back in time to detect which are rewritten
+  std::time_t oldTime = openstudio::filesystem::last_write_time(outpaths[0]) - 1000;
+  for (const auto& p : outpaths){
+    openstudio::filesystem::last_write_time(p, oldTime);
+  }
+
+  // nothing changed, no files are written
+  std::vector<path> outpaths2 = ft.translateModel(outpath, model);
+  EXPECT_EQ(outpaths.size(), outpaths2.size()) << printPaths(outpaths2);
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+  for (const auto& p : outpaths2){
+    ASSERT_TRUE(openstudio::filesystem::exists(p));
+    EXPECT_EQ(oldTime, openstudio::filesystem::last_write_time(p)) << toString(p);
+  }
+
+  // files which were not written by the translator are left alone
+  openstudio::path otherFile = outpath / toPath("scene") / toPath("other.rad");
+  {
+    std::ofstream other(toString(otherFile).c_str());
+    other << "# not written by the translator" << std::endl;
+  }
+
+  // renaming a space writes a new scene file and removes the old one
+  std::vector<Space> spaces = model.getUniqueModelObject<Building>().spaces();
+  ASSERT_FALSE(spaces.empty());
+  openstudio::path oldScene = outpath / toPath("scene") / toPath(cleanName(spaces[0].nameString()) + ".rad");
+  EXPECT_TRUE(openstudio::filesystem::exists(oldScene));
+  spaces[0].setName(spaces[0].nameString() + " Renamed");
+  openstudio::path newScene = outpath / toPath("scene") / toPath(cleanName(spaces[0].nameString()) + ".rad");
+
+  outpaths2 = ft.translateModel(outpath, model);
+  EXPECT_FALSE(outpaths2.empty());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+  EXPECT_FALSE(openstudio::filesystem::exists(oldScene));
+  EXPECT_TRUE(openstudio::filesystem::exists(newScene));
+  EXPECT_NE(oldTime, openstudio::filesystem::last_write_time(newScene));
+  for (const auto& p : outpaths2){
+    EXPECT_TRUE(openstudio::filesystem::exists(p)) << toString(p);
+  }
+  EXPECT_TRUE(openstudio::filesystem::exists(otherFile));
+
+  // a translation from scratch gives the same files
+  ForwardTranslator ft2;
+  std::vector<path> outpaths3 = ft2.translateModel(toPath("./ForwardTranslator_ExampleModel_Incremental2"), model);
+  EXPECT_EQ(outpaths2.size(), outpaths3.size());
+}
+
+
 TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 {
   Model model = exampleModel();
@@ -227,6 +292,45 @@ TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 }
 
 
+TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl_Incremental)
+{
+  Model model = exampleModel();
+  Construction shadedConstruction(model);
+
+  model::ShadingControl shadingControl(shadedConstruction);
+  for (auto & subSurface : model.getConcreteModelObjects<model::SubSurface>()){
+    if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") ||
+        istringEqual(subSurface.subSurfaceType(), "OperableWindow")){
+      subSurface.setShadingControl(shadingControl);
+    }
+  }
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModelWithShadingControl_Incremental");
+  openstudio::filesystem::remove_all(outpath);
+  ASSERT_FALSE(openstudio::filesystem::exists(outpath));
+
+  ForwardTranslator ft;
+  ft.setIncrementalTranslation(true);
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  ASSERT_FALSE(outpaths.empty());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  // set all files back in time to detect which are rewritten
+  std::time_t oldTime = openstudio::filesystem::last_write_time(outpaths[0]) - 1000;
+  for (const auto& p : outpaths){
+    openstudio::filesystem::last_write_time(p, oldTime);
+  }
+
+  // controlled window groups are numbered from WG1 again and get the same windows, no files are written
+  std::vector<path> outpaths2 = ft.translateModel(outpath, model);
+  EXPECT_EQ(std::set<path>(outpaths.begin(), outpaths.end()), std::set<path>(outpaths2.begin(), outpaths2.end())) << printPaths(outpaths2);
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+  for (const auto& p : outpaths2){
+    ASSERT_TRUE(openstudio::filesystem::exists(p));
+    EXPECT_EQ(oldTime, openstudio::filesystem::last_write_time(p)) << toString(p);
+  }
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModel_NoIllumMaps)
 {
   Model model = exampleModel();
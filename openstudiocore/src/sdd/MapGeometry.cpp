@@ -110,6 +110,7 @@
 #include "../utilities/units/TemperatureUnit_Impl.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 
 #include <QDomDocument>
 #include <QDomElement>
@@ -162,9 +163,9 @@ namespace sdd {
     // The angle between True North and the the model Y-Axis, measured clockwise from True North in Degrees.  
     QDomElement buildingAzimuthElement = element.firstChildElement("BldgAz"); // this corresponds to Building::North Axis
 
-    QDomNodeList spaceElements = element.elementsByTagName("Spc");
-    QDomNodeList thermalZoneElements = element.elementsByTagName("ThrmlZn");
-    QDomNodeList buildingStoryElements = element.elementsByTagName("Story");
+    const std::vector<QDomElement>& spaceElements = indexedElements("Spc");
+    const std::vector<QDomElement>& thermalZoneElements = indexedElements("ThrmlZn");
+    const std::vector<QDomElement>& buildingStoryElements = indexedElements("Story");
 
     if (nameElement.isNull()){
       LOG(Error, "Bldg element 'Name' is empty.")
@@ -183,13 +184,13 @@ namespace sdd {
     }
 
     // translate shadingSurfaces
-    QDomNodeList exteriorShadingElements = element.elementsByTagName("ExtShdgObj");
+    const std::vector<QDomElement>& exteriorShadingElements = indexedElements("ExtShdgObj");
     model::ShadingSurfaceGroup shadingSurfaceGroup(model);
     shadingSurfaceGroup.setName("Building ShadingGroup");
     shadingSurfaceGroup.setShadingSurfaceType("Building");
-    for (int i = 0; i < exteriorShadingElements.count(); ++i){
-      if (exteriorShadingElements.at(i).parentNode() == element){
-        boost::optional<model::ModelObject> exteriorShading = translateShadingSurface(exteriorShadingElements.at(i).toElement(), doc, shadingSurfaceGroup);
+    for (unsigned i = 0; i < exteriorShadingElements.size(); ++i){
+      if (exteriorShadingElements[i].parentNode() == element){
+        boost::optional<model::ModelObject> exteriorShading = translateShadingSurface(exteriorShadingElements[i], doc, shadingSurfaceGroup);
         if (!exteriorShading){
           LOG(Error, "Failed to translate 'ExtShdgObj' element " << i);
         }
@@ -197,8 +198,8 @@ namespace sdd {
     }
 
     // create all spaces
-    for (int i = 0; i < spaceElements.count(); i++){
-      QDomElement spaceElement = spaceElements.at(i).toElement();
+    for (unsigned i = 0; i < spaceElements.size(); i++){
+      QDomElement spaceElement = spaceElements[i];
       boost::optional<model::ModelObject> space = createSpace(spaceElement, doc, model);
       if (!space){
         LOG(Error, "Failed to translate 'Spc' element " << i);
@@ -206,14 +207,14 @@ namespace sdd {
     }
 
     // create all thermal zones
-    for (int i = 0; i < thermalZoneElements.count(); i++){
+    for (unsigned i = 0; i < thermalZoneElements.size(); i++){
 
-      if (thermalZoneElements.at(i).firstChildElement("Name").isNull()){
+      if (thermalZoneElements[i].firstChildElement("Name").isNull()){
         LOG(Error, "ThrmlZn element 'Name' is empty, object will not be translated.")
         continue;
       }
 
-      QDomElement thermalZoneElement = thermalZoneElements.at(i).toElement();
+      QDomElement thermalZoneElement = thermalZoneElements[i];
 
       boost::optional<model::ModelObject> thermalZone = createThermalZone(thermalZoneElement, doc, model);
       if (!thermalZone){
@@ -225,12 +226,12 @@ namespace sdd {
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Storys"));
       m_progressBar->setMinimum(0);
-      m_progressBar->setMaximum(buildingStoryElements.count());
+      m_progressBar->setMaximum(buildingStoryElements.size());
       m_progressBar->setValue(0);
     }
 
-    for (int i = 0; i < buildingStoryElements.count(); i++){
-      QDomElement buildingStoryElement = buildingStoryElements.at(i).toElement();
+    for (unsigned i = 0; i < buildingStoryElements.size(); i++){
+      QDomElement buildingStoryElement = buildingStoryElements[i];
       boost::optional<model::ModelObject> buildingStory = translateBuildingStory(buildingStoryElement, doc, model);
       if (!buildingStory){
         LOG(Error, "Failed to translate 'Story' element " << i);
@@ -270,9 +271,26 @@ namespace sdd {
       thermalZone.setName(escapeName(nameElement.text()));
     }
 
+    // remember the zone so references by name do not need to search the whole model
+    m_thermalZoneHandles.insert(std::make_pair(boost::to_lower_copy(thermalZone.name().get()), thermalZone.handle()));
+
     return thermalZone;
   }
 
+  boost::optional<model::ThermalZone> ReverseTranslator::thermalZoneByName(const std::string& name, const openstudio::model::Model& model) const
+  {
+    auto it = m_thermalZoneHandles.find(boost::to_lower_copy(name));
+    if (it != m_thermalZoneHandles.end()){
+      boost::optional<model::ThermalZone> thermalZone = model.getModelObject<model::ThermalZone>(it->second);
+      if (thermalZone && istringEqual(thermalZone->name().get(), name)){
+        return thermalZone;
+      }
+    }
+
+    // zone was renamed or not created by this translator
+    return model.getModelObjectByName<model::ThermalZone>(name);
+  }
+
   boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
   {
     QDomElement nameElement = element.firstChildElement("Name");
@@ -310,10 +328,27 @@ namespace sdd {
     } else{
       space.setName(escapeName(nameElement.text()));
     }
+
+    // remember the space so references by name do not need to search the whole model
+    m_spaceHandles.insert(std::make_pair(boost::to_lower_copy(space.name().get()), space.handle()));
     
     return space;
   }
 
+  boost::optional<model::Space> ReverseTranslator::spaceByName(const std::string& name, const openstudio::model::Model& model) const
+  {
+    auto it = m_spaceHandles.find(boost::to_lower_copy(name));
+    if (it != m_spaceHandles.end()){
+      boost::optional<model::Space> space = model.getModelObject<model::Space>(it->second);
+      if (space && istringEqual(space->name().get(), name)){
+        return space;
+      }
+    }
+
+    // space was renamed or not created by this translator
+    return model.getModelObjectByName<model::Space>(name);
+  }
+
   boost::optional<model::ModelObject> ReverseTranslator::translateSpace(const QDomElement& element, const QDomDocument& doc, openstudio::model::BuildingStory& buildingStory)
   {
     QDomElement nameElement = element.firstChildElement("Name");
@@ -337,7 +372,7 @@ namespace sdd {
       spaceName = escapeName(nameElement.text());
     }
 
-    boost::optional<model::Space> space = buildingStory.model().getModelObjectByName<model::Space>(spaceName);
+    boost::optional<model::Space> space = spaceByName(spaceName, buildingStory.model());
     if (!space){
       LOG(Error, "Could not retrieve Space named '" << spaceName << "'.");
       return boost::none;
@@ -353,7 +388,7 @@ namespace sdd {
       thermalZoneName = escapeName(thermalZoneElement.text());
     }
 
-    boost::optional<model::ThermalZone> thermalZone = space->model().getModelObjectByName<model::ThermalZone>(thermalZoneName);
+    boost::optional<model::ThermalZone> thermalZone = thermalZoneByName(thermalZoneName, space->model());
     if (thermalZone){
       space->setThermalZone(*thermalZone);
     } else{
@@ -1436,7 +1471,7 @@ namespace sdd {
     QDomElement adjacentSpaceElement = element.firstChildElement("AdjacentSpcRef");
     if (!adjacentSpaceElement.isNull()){
       std::string adjacentSpaceName = escapeName(adjacentSpaceElement.text());
-      boost::optional<model::Space> otherSpace = space.model().getModelObjectByName<model::Space>(adjacentSpaceName);
+      boost::optional<model::Space> otherSpace = spaceByName(adjacentSpaceName, space.model());
 
       if (!otherSpace){
         LOG(Error, "Cannot retrieve adjacent Space '" << adjacentSpaceName << "' for Surface named '" << name << "'");
@@ -4059,7 +4059,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   // Name
   QDomElement nameElement = thermalZoneElement.firstChildElement("Name");
   std::string name = nameElement.text().toStdString();
-  optionalThermalZone = model.getModelObjectByName<model::ThermalZone>(name);
+  optionalThermalZone = thermalZoneByName(name, model);
 
   if( ! optionalThermalZone )
   {
@@ -4603,7 +4603,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
           ventSysEquip = trmlUnit;
           airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
           QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-          if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+          if( boost::optional<model::ThermalZone> tz = thermalZoneByName(inducedAirZnRefElement.text().toStdString(), model) )
           {
              if( tz->isPlenum() )
              {
@@ -4690,7 +4690,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
             sysInfo.ModelObject = trmlUnit;
             airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
             QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-            if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+            if( boost::optional<model::ThermalZone> tz = thermalZoneByName(inducedAirZnRefElement.text().toStdString(), model) )
             {
                if( tz->isPlenum() )
                {
@@ -4908,7 +4908,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   {
     QDomElement rtnPlenumZnRefElement = thermalZoneElement.firstChildElement("RetPlenumZnRef");
     boost::optional<model::ThermalZone> returnPlenumZone;
-    returnPlenumZone = model.getModelObjectByName<model::ThermalZone>(rtnPlenumZnRefElement.text().toStdString()); 
+    returnPlenumZone = thermalZoneByName(rtnPlenumZnRefElement.text().toStdString(), model); 
     if( returnPlenumZone )
     {
       thermalZone.setReturnPlenum(returnPlenumZone.get());  
@@ -4916,7 +4916,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement supPlenumZnRefElement = thermalZoneElement.firstChildElement("SupPlenumZnRef");
     boost::optional<model::ThermalZone> supplyPlenumZone;
-    supplyPlenumZone = model.getModelObjectByName<model::ThermalZone>(supPlenumZnRefElement.text().toStdString());
+    supplyPlenumZone = thermalZoneByName(supPlenumZnRefElement.text().toStdString(), model);
     if( supplyPlenumZone )
     {
       thermalZone.setSupplyPlenum(supplyPlenumZone.get());
@@ -5174,28 +5174,23 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
 
       QDomElement zoneServedElement = trmlUnitElement.firstChildElement("ZnServedRef");
 
-      QDomNodeList thrmlZnElements = trmlUnitElement.parentNode().parentNode().parentNode().toElement().elementsByTagName("ThrmlZn");
+      QDomElement thrmlZnParentElement = trmlUnitElement.parentNode().parentNode().parentNode().toElement();
 
-      for( int j = 0; j < thrmlZnElements.count(); j++ )
-      {
-        QDomElement thrmlZnElement = thrmlZnElements.at(j).toElement();
-
-        QDomElement thrmlZnNameElement = thrmlZnElement.firstChildElement("Name");
+      std::vector<QDomElement> thrmlZnElements = indexedElementsByChildText(thrmlZnParentElement, "ThrmlZn", "Name", zoneServedElement.text());
 
-        if(istringEqual(thrmlZnNameElement.text().toStdString(),zoneServedElement.text().toStdString()))
-        {
-          QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
+      if( ! thrmlZnElements.empty() )
+      {
+        QDomElement thrmlZnElement = thrmlZnElements.front();
 
-          value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
+        QDomElement htgDsgnMaxFlowFracElement = thrmlZnElement.firstChildElement("HtgDsgnMaxFlowFrac");
 
-          if( ok )
-          {
-            terminal.setMaximumFlowFractionDuringReheat(value);
+        value = htgDsgnMaxFlowFracElement.text().toDouble(&ok);
 
-            found = true;
-          }
+        if( ok )
+        {
+          terminal.setMaximumFlowFractionDuringReheat(value);
 
-          break;
+          found = true;
         }
       }
 
@@ -6957,7 +6952,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   if( istringEqual("Zone",text) ) {
     tes.setAmbientTemperatureIndicator("Zone");
     text = tesElement.firstChildElement("StorZnRef").text().toStdString();
-    if( auto tz = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto tz = thermalZoneByName(text, model) ) {
       tes.setAmbientTemperatureThermalZone(tz.get());
     }
   } else {
@@ -7363,7 +7358,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
 
     // Might have to relocate after zones are available
     text = element.firstChildElement("CprsrZnRef").text().toStdString();
-    if( auto zone = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto zone = thermalZoneByName(text, model) ) {
       heatPump.addToThermalZone(zone.get());
     }
 
@@ -7407,7 +7402,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
     }
 
     text = element.firstChildElement("StorZnRef").text().toStdString();
-    if( auto zone = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto zone = thermalZoneByName(text, model) ) {
       waterHeater.setAmbientTemperatureThermalZone(zone.get());
     }
 
@@ -9291,18 +9286,11 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCrvM
 
 QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
 {
-  QDomNodeList znSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("ZnSys");
+  std::vector<QDomElement> znSysElements = indexedElementsByChildText("ZnSys", "Name", znSysName, true);
 
-  for (int i = 0; i < znSysElements.count(); i++)
+  if( ! znSysElements.empty() )
   {
-    QDomElement znSysElement = znSysElements.at(i).toElement();
-
-    QDomElement znSysNameElement = znSysElement.firstChildElement("Name");
-
-    if( znSysNameElement.text() == znSysName )
-    {
-      return znSysElement;
-    }
+    return znSysElements.front();
   }
 
   return QDomElement();
@@ -9310,18 +9298,14 @@ QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const
 
 QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
+  std::vector<QDomElement> terminalElements = indexedElementsByChildText("TrmlUnit", "ZnServedRef", zoneName);
   
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  for( const auto & terminalElement : terminalElements )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
-    for( int j = 0; j < terminalElements.count(); j++ )
+    // only terminals that are part of an air system
+    for( QDomNode parent = terminalElement.parentNode(); ! parent.isNull(); parent = parent.parentNode() )
     {
-      QDomElement terminalElement = terminalElements.at(j).toElement();
-      QDomElement zoneServedElement = terminalElement.firstChildElement("ZnServedRef");
-  
-      if(zoneName.compare(zoneServedElement.text(),Qt::CaseInsensitive) == 0)
+      if( parent.toElement().tagName() == "AirSys" )
       {
         return terminalElement;
       }
@@ -9333,17 +9317,11 @@ QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneNa
 
 QDomElement ReverseTranslator::findAirSysElement(const QString & airSysName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-  
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  std::vector<QDomElement> airSystemElements = indexedElementsByChildText("AirSys", "Name", airSysName);
+
+  if( ! airSystemElements.empty() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
-  
-    if(airSysName.compare(airSystemNameElement.text(),Qt::CaseInsensitive) == 0)
-    {
-      return airSystemElement;
-    }
+    return airSystemElements.front();
   }
 
   return QDomElement();
@@ -228,7 +228,102 @@ namespace sdd {
 
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
-    return translateSDD(doc.documentElement(), doc);
+    m_spaceHandles.clear();
+    m_thermalZoneHandles.clear();
+
+    indexElements(doc.documentElement().firstChildElement("Proj"));
+
+    boost::optional<model::Model> result = translateSDD(doc.documentElement(), doc);
+
+    m_elementsByTagName.clear();
+    m_elementsByChildText.clear();
+
+    return result;
+  }
+
+  void ReverseTranslator::indexElements(const QDomElement& projectElement)
+  {
+    m_elementsByTagName.clear();
+    m_elementsByChildText.clear();
+
+    if (projectElement.isNull()){
+      return;
+    }
+
+    // pre-order traversal of all descendants of projectElement, same order as elementsByTagName
+    QDomElement element = projectElement.firstChildElement();
+    while (!element.isNull()){
+      m_elementsByTagName[element.tagName()].push_back(element);
+
+      QDomElement next = element.firstChildElement();
+      if (next.isNull()){
+        QDomElement current = element;
+        while (next.isNull() && (current != projectElement)){
+          next = current.nextSiblingElement();
+          if (next.isNull()){
+            current = current.parentNode().toElement();
+          }
+        }
+      }
+      element = next;
+    }
+  }
+
+  const std::vector<QDomElement>& ReverseTranslator::indexedElements(const QString& tagName) const
+  {
+    static const std::vector<QDomElement> empty;
+
+    auto it = m_elementsByTagName.find(tagName);
+    if (it != m_elementsByTagName.end()){
+      return it->second;
+    }
+    return empty;
+  }
+
+  std::vector<QDomElement> ReverseTranslator::indexedElementsByChildText(const QString& tagName, const QString& childTagName, const QString& value, bool caseSensitive)
+  {
+    std::pair<QString, QString> key = std::make_pair(tagName, childTagName);
+
+    auto it = m_elementsByChildText.find(key);
+    if (it == m_elementsByChildText.end()){
+      std::map<QString, std::vector<QDomElement> > lookup;
+      for (const QDomElement& element : indexedElements(tagName)){
+        lookup[element.firstChildElement(childTagName).text().toLower()].push_back(element);
+      }
+      it = m_elementsByChildText.insert(std::make_pair(key, lookup)).first;
+    }
+
+    std::vector<QDomElement> result;
+
+    auto lookupIt = it->second.find(value.toLower());
+    if (lookupIt != it->second.end()){
+      if (caseSensitive){
+        for (const QDomElement& element : lookupIt->second){
+          if (element.firstChildElement(childTagName).text() == value){
+            result.push_back(element);
+          }
+        }
+      }else{
+        result = lookupIt->second;
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<QDomElement> ReverseTranslator::indexedElementsByChildText(const QDomElement& ancestor, const QString& tagName, const QString& childTagName, const QString& value, bool caseSensitive)
+  {
+    std::vector<QDomElement> result;
+    for (const QDomElement& element : indexedElementsByChildText(tagName, childTagName, value, caseSensitive)){
+      for (QDomNode parent = element.parentNode(); !parent.isNull(); parent = parent.parentNode()){
+        if (parent == ancestor){
+          result.push_back(element);
+          break;
+        }
+      }
+    }
+
+    return result;
   }
 
   boost::optional<model::Model> ReverseTranslator::translateSDD(const QDomElement& element, const QDomDocument& doc)
@@ -305,16 +400,16 @@ namespace sdd {
       sp.setCoolingSizingFactor(1.0);
 
       // do materials before constructions
-      QDomNodeList materialElements = projectElement.elementsByTagName("Mat");
+      const std::vector<QDomElement>& materialElements = indexedElements("Mat");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Materials"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(materialElements.count()); 
+        m_progressBar->setMaximum(materialElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < materialElements.count(); i++){
-        QDomElement materialElement = materialElements.at(i).toElement();
+      for (unsigned i = 0; i < materialElements.size(); i++){
+        QDomElement materialElement = materialElements[i];
         boost::optional<model::ModelObject> material = translateMaterial(materialElement, doc, *result);
         if (!material){
           LOG(Error, "Failed to translate 'Mat' element " << i);
@@ -328,16 +423,16 @@ namespace sdd {
       // do constructions before geometry
 
       // layered constructions
-      QDomNodeList constructionElements = projectElement.elementsByTagName("ConsAssm");
+      const std::vector<QDomElement>& constructionElements = indexedElements("ConsAssm");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Constructions"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(constructionElements.count()); 
+        m_progressBar->setMaximum(constructionElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < constructionElements.count(); i++){
-        QDomElement constructionElement = constructionElements.at(i).toElement();
+      for (unsigned i = 0; i < constructionElements.size(); i++){
+        QDomElement constructionElement = constructionElements[i];
         boost::optional<model::ModelObject> construction = translateConstructAssembly(constructionElement, doc, *result);
         if (!construction){
           LOG(Error, "Failed to translate 'ConsAssm' element " << i);
@@ -349,16 +444,16 @@ namespace sdd {
       }
 
       // door constructions
-      QDomNodeList doorConstructionElements = projectElement.elementsByTagName("DrCons");
+      const std::vector<QDomElement>& doorConstructionElements = indexedElements("DrCons");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Door Constructions"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(doorConstructionElements.count()); 
+        m_progressBar->setMaximum(doorConstructionElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < doorConstructionElements.count(); i++){
-        QDomElement doorConstructionElement = doorConstructionElements.at(i).toElement();
+      for (unsigned i = 0; i < doorConstructionElements.size(); i++){
+        QDomElement doorConstructionElement = doorConstructionElements[i];
         boost::optional<model::ModelObject> doorConstruction = translateDoorConstruction(doorConstructionElement, doc, *result);
         if (!doorConstruction){
           LOG(Error, "Failed to translate 'DrCons' element " << i);
@@ -370,16 +465,16 @@ namespace sdd {
       }
 
       // fenestration constructions
-      QDomNodeList fenestrationConstructionElements = projectElement.elementsByTagName("FenCons");
+      const std::vector<QDomElement>& fenestrationConstructionElements = indexedElements("FenCons");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Fenestration Constructions"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(fenestrationConstructionElements.count()); 
+        m_progressBar->setMaximum(fenestrationConstructionElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < fenestrationConstructionElements.count(); i++){
-        QDomElement fenestrationConstructionElement = fenestrationConstructionElements.at(i).toElement();
+      for (unsigned i = 0; i < fenestrationConstructionElements.size(); i++){
+        QDomElement fenestrationConstructionElement = fenestrationConstructionElements[i];
         boost::optional<model::ModelObject> fenestrationConstruction = translateFenestrationConstruction(fenestrationConstructionElement, doc, *result);
         if (!fenestrationConstruction){
           LOG(Error, "Failed to translate 'FenCons' element " << i);
@@ -390,54 +485,54 @@ namespace sdd {
         }
       }
 
-      QDomNodeList crvDblQuadElements = projectElement.elementsByTagName("CrvDblQuad");
-      for (int i = 0; i < crvDblQuadElements.count(); i++){
-        QDomElement crvDblQuadElement = crvDblQuadElements.at(i).toElement();
+      const std::vector<QDomElement>& crvDblQuadElements = indexedElements("CrvDblQuad");
+      for (unsigned i = 0; i < crvDblQuadElements.size(); i++){
+        QDomElement crvDblQuadElement = crvDblQuadElements[i];
         boost::optional<model::ModelObject> curve = translateCrvDblQuad(crvDblQuadElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvDblQuad' element " << i);
         }
       }
 
-      QDomNodeList crvCubicElements = projectElement.elementsByTagName("CrvCubic");
-      for (int i = 0; i < crvCubicElements.count(); i++){
-        QDomElement crvCubicElement = crvCubicElements.at(i).toElement();
+      const std::vector<QDomElement>& crvCubicElements = indexedElements("CrvCubic");
+      for (unsigned i = 0; i < crvCubicElements.size(); i++){
+        QDomElement crvCubicElement = crvCubicElements[i];
         boost::optional<model::ModelObject> curve = translateCrvCubic(crvCubicElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvCubic' element " << i);
         }
       }
 
-      QDomNodeList crvQuadElements = projectElement.elementsByTagName("CrvQuad");
-      for (int i = 0; i < crvQuadElements.count(); i++){
-        QDomElement crvQuadElement = crvQuadElements.at(i).toElement();
+      const std::vector<QDomElement>& crvQuadElements = indexedElements("CrvQuad");
+      for (unsigned i = 0; i < crvQuadElements.size(); i++){
+        QDomElement crvQuadElement = crvQuadElements[i];
         boost::optional<model::ModelObject> curve = translateCrvQuad(crvQuadElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvQuad' element " << i);
         }
       }
 
-      QDomNodeList crvLinElements = projectElement.elementsByTagName("CrvLin");
-      for (int i = 0; i < crvLinElements.count(); i++){
-        QDomElement crvLinElement = crvLinElements.at(i).toElement();
+      const std::vector<QDomElement>& crvLinElements = indexedElements("CrvLin");
+      for (unsigned i = 0; i < crvLinElements.size(); i++){
+        QDomElement crvLinElement = crvLinElements[i];
         boost::optional<model::ModelObject> curve = translateCrvLin(crvLinElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvLin' element " << i);
         }
       }
 
-      auto crvMapSglVarElements = projectElement.elementsByTagName("CrvMapSglVar");
-      for (int i = 0; i < crvMapSglVarElements.count(); i++){
-        auto crvMapSglVarElement = crvMapSglVarElements.at(i).toElement();
+      const std::vector<QDomElement>& crvMapSglVarElements = indexedElements("CrvMapSglVar");
+      for (unsigned i = 0; i < crvMapSglVarElements.size(); i++){
+        const QDomElement& crvMapSglVarElement = crvMapSglVarElements[i];
         auto curve = translateCrvMapSglVar(crvMapSglVarElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvMapSglVar' element " << i);
         }
       }
 
-      auto crvMapDblVarElements = projectElement.elementsByTagName("CrvMapDblVar");
-      for (int i = 0; i < crvMapDblVarElements.count(); i++){
-        auto crvMapDblVarElement = crvMapDblVarElements.at(i).toElement();
+      const std::vector<QDomElement>& crvMapDblVarElements = indexedElements("CrvMapDblVar");
+      for (unsigned i = 0; i < crvMapDblVarElements.size(); i++){
+        const QDomElement& crvMapDblVarElement = crvMapDblVarElements[i];
         auto curve = translateCrvMapDblVar(crvMapDblVarElement, doc, *result);
         if (!curve){
           LOG(Error, "Failed to translate 'CrvMapDblVar' element " << i);
@@ -445,16 +540,16 @@ namespace sdd {
       }
 
       // do schedules before loads
-      QDomNodeList scheduleDayElements = projectElement.elementsByTagName("SchDay");
+      const std::vector<QDomElement>& scheduleDayElements = indexedElements("SchDay");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Day Schedules"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(scheduleDayElements.count()); 
+        m_progressBar->setMaximum(scheduleDayElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < scheduleDayElements.count(); i++){
-        QDomElement scheduleDayElement = scheduleDayElements.at(i).toElement();
+      for (unsigned i = 0; i < scheduleDayElements.size(); i++){
+        QDomElement scheduleDayElement = scheduleDayElements[i];
         boost::optional<model::ModelObject> scheduleDay = translateScheduleDay(scheduleDayElement, doc, *result);
         if (!scheduleDay){
           LOG(Error, "Failed to translate 'SchDay' element " << i);
@@ -465,16 +560,16 @@ namespace sdd {
         }
       }
 
-      QDomNodeList scheduleWeekElements = projectElement.elementsByTagName("SchWeek");
+      const std::vector<QDomElement>& scheduleWeekElements = indexedElements("SchWeek");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Week Schedules"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(scheduleWeekElements.count()); 
+        m_progressBar->setMaximum(scheduleWeekElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < scheduleWeekElements.count(); i++){
-        QDomElement scheduleWeekElement = scheduleWeekElements.at(i).toElement();
+      for (unsigned i = 0; i < scheduleWeekElements.size(); i++){
+        QDomElement scheduleWeekElement = scheduleWeekElements[i];
         boost::optional<model::ModelObject> scheduleWeek = translateScheduleWeek(scheduleWeekElement, doc, *result);
         if (!scheduleWeek){
           LOG(Error, "Failed to translate 'SchWeek' element " << i);
@@ -485,16 +580,16 @@ namespace sdd {
         }
       }
 
-      QDomNodeList scheduleElements = projectElement.elementsByTagName("Sch");
+      const std::vector<QDomElement>& scheduleElements = indexedElements("Sch");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Year Schedules"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(scheduleElements.count()); 
+        m_progressBar->setMaximum(scheduleElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < scheduleElements.count(); i++){
-        QDomElement scheduleElement = scheduleElements.at(i).toElement();
+      for (unsigned i = 0; i < scheduleElements.size(); i++){
+        QDomElement scheduleElement = scheduleElements[i];
         boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, doc, *result);
         if (!schedule){
           LOG(Error, "Failed to translate 'Sch' element " << i);
@@ -505,16 +600,16 @@ namespace sdd {
         }
       }
 
-      QDomNodeList holidayElements = projectElement.elementsByTagName("Hol");
+      const std::vector<QDomElement>& holidayElements = indexedElements("Hol");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Holidays"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(holidayElements.count()); 
+        m_progressBar->setMaximum(holidayElements.size()); 
         m_progressBar->setValue(0);
       }
 
-      for (int i = 0; i < holidayElements.count(); i++){
-        QDomElement holidayElement = holidayElements.at(i).toElement();
+      for (unsigned i = 0; i < holidayElements.size(); i++){
+        QDomElement holidayElement = holidayElements[i];
         boost::optional<model::ModelObject> holiday = translateHoliday(holidayElement, doc, *result);
         if (!holiday){
           LOG(Error, "Failed to translate 'Hol' element " << i);
@@ -532,13 +627,13 @@ namespace sdd {
       //}
 
       // translate shadingSurfaces
-      QDomNodeList exteriorShadingElements = element.elementsByTagName("ExtShdgObj");
+      const std::vector<QDomElement>& exteriorShadingElements = indexedElements("ExtShdgObj");
       model::ShadingSurfaceGroup shadingSurfaceGroup(*result);
       shadingSurfaceGroup.setName("Site ShadingGroup");
       shadingSurfaceGroup.setShadingSurfaceType("Site");
-      for (int i = 0; i < exteriorShadingElements.count(); ++i){
-        if (exteriorShadingElements.at(i).parentNode() == projectElement){
-          boost::optional<model::ModelObject> exteriorShading = translateShadingSurface(exteriorShadingElements.at(i).toElement(), doc, shadingSurfaceGroup);
+      for (unsigned i = 0; i < exteriorShadingElements.size(); ++i){
+        if (exteriorShadingElements[i].parentNode() == projectElement){
+          boost::optional<model::ModelObject> exteriorShading = translateShadingSurface(exteriorShadingElements[i], doc, shadingSurfaceGroup);
           if (!exteriorShading){
             LOG(Error, "Failed to translate 'ExtShdgObj' element " << i);
           }
@@ -561,24 +656,24 @@ namespace sdd {
       result->setFastNaming(false);
 
       // FluidSys
-      QDomNodeList fluidSysElements = projectElement.elementsByTagName("FluidSys");
+      const std::vector<QDomElement>& fluidSysElements = indexedElements("FluidSys");
       if (m_progressBar){
         m_progressBar->setWindowTitle(toString("Translating Fluid Systems"));
         m_progressBar->setMinimum(0);
-        m_progressBar->setMaximum(fluidSysElements.count()); 
+        m_progressBar->setMaximum(fluidSysElements.size()); 
         m_progressBar->setValue(0);
       }
 
       // Translate condenser systems
-      for (int i = 0; i < fluidSysElements.count(); i++){
-        if (fluidSysElements.at(i).firstChildElement("Name").isNull()){
+      for (unsigned i = 0; i < fluidSysElements.size(); i++){
+        if (fluidSysElements[i].firstChildElement("Name").isNull()){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() != "condenserwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() != "condenserwater"){
           continue;
         }
 
-        QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+        QDomElement fluidSysElement = fluidSysElements[i];
         boost::optional<model::ModelObject> plantLoop = translateFluidSys(fluidSysElement,doc,*result);
         OS_ASSERT(plantLoop);
 
@@ -588,21 +683,21 @@ namespace sdd {
       }
 
       // Translate hot water systems
-      for (int i = 0; i < fluidSysElements.count(); i++){
-        if (fluidSysElements.at(i).firstChildElement("Name").isNull()){
+      for (unsigned i = 0; i < fluidSysElements.size(); i++){
+        if (fluidSysElements[i].firstChildElement("Name").isNull()){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "servicehotwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "servicehotwater"){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "condenserwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "condenserwater"){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "chilledwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "chilledwater"){
           continue;
         }
 
-        QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+        QDomElement fluidSysElement = fluidSysElements[i];
         boost::optional<model::ModelObject> plantLoop = translateFluidSys(fluidSysElement,doc,*result);
         OS_ASSERT(plantLoop);
 
@@ -612,21 +707,21 @@ namespace sdd {
       }
 
       // Translate chilled water systems
-      for (int i = 0; i < fluidSysElements.count(); i++){
-        if (fluidSysElements.at(i).firstChildElement("Name").isNull()){
+      for (unsigned i = 0; i < fluidSysElements.size(); i++){
+        if (fluidSysElements[i].firstChildElement("Name").isNull()){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "servicehotwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "servicehotwater"){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "condenserwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "condenserwater"){
           continue;
         }
-        if (fluidSysElements.at(i).firstChildElement("Type").text().toLower() == "hotwater"){
+        if (fluidSysElements[i].firstChildElement("Type").text().toLower() == "hotwater"){
           continue;
         }
 
-        QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+        QDomElement fluidSysElement = fluidSysElements[i];
         boost::optional<model::ModelObject> plantLoop = translateFluidSys(fluidSysElement,doc,*result);
         OS_ASSERT(plantLoop);
 
@@ -2056,23 +2151,13 @@ namespace sdd {
 
 QDomElement ReverseTranslator::supplySegment(const QString & fluidSegmentName, const QDomDocument& doc)
 {
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++) {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
+  for (const QDomElement& fluidSegmentElement : indexedElementsByChildText("FluidSeg", "Name", fluidSegmentName)) {
+    QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
 
-    for (int i = 0; i < fluidSegmentElements.count(); i++) {
-      QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-      QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-      QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-      if( (typeElement.text().toLower() == "secondarysupply" ||
-           typeElement.text().toLower() == "primarysupply" ) &&
-           nameElement.text().toLower() == fluidSegmentName.toLower() ) {
-        return fluidSegmentElement; 
-      }
+    if( (typeElement.text().toLower() == "secondarysupply" ||
+         typeElement.text().toLower() == "primarysupply" ) &&
+         fluidSegmentElement.parentNode().toElement().tagName() == "FluidSys" ) {
+      return fluidSegmentElement; 
     }
   }
 
@@ -55,6 +55,7 @@ namespace model {
   class ModelObject;
   class BuildingStory;
   class Space;
+  class ThermalZone;
   class ShadingSurfaceGroup;
   class PlanarSurface;
   class Surface;
@@ -158,6 +159,31 @@ namespace sdd {
     // Return the "TrmlUnit" element serving zoneName
     QDomElement findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc);
 
+    // Builds an index of all elements under the Proj element by tag name in a single pass,
+    // this replaces repeated elementsByTagName walks of the whole document
+    void indexElements(const QDomElement& projectElement);
+
+    // Return all indexed elements with tagName in document order
+    const std::vector<QDomElement>& indexedElements(const QString& tagName) const;
+
+    // Return all indexed elements with tagName whose first childTagName child has text equal to value, in document order
+    // The lookup table for each tagName and childTagName pair is built on first use
+    std::vector<QDomElement> indexedElementsByChildText(const QString& tagName, const QString& childTagName, const QString& value, bool caseSensitive = false);
+
+    // As above but only elements which are descendants of ancestor
+    std::vector<QDomElement> indexedElementsByChildText(const QDomElement& ancestor, const QString& tagName, const QString& childTagName, const QString& value, bool caseSensitive = false);
+
+    std::map<QString, std::vector<QDomElement> > m_elementsByTagName;
+    std::map<std::pair<QString, QString>, std::map<QString, std::vector<QDomElement> > > m_elementsByChildText;
+
+    // Return the Space or ThermalZone created from the SDD with name, avoids scanning the whole model by name
+    boost::optional<model::Space> spaceByName(const std::string& name, const openstudio::model::Model& model) const;
+    boost::optional<model::ThermalZone> thermalZoneByName(const std::string& name, const openstudio::model::Model& model) const;
+
+    // lower case name => handle of Spaces and ThermalZones created by createSpace and createThermalZone
+    std::map<std::string, openstudio::Handle> m_spaceHandles;
+    std::map<std::string, openstudio::Handle> m_thermalZoneHandles;
+
     model::Schedule alwaysOnSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_alwaysOnSchedule;
 
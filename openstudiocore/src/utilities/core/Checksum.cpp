@@ -27,62 +27,167 @@
  **********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "Filesystem.hpp"
 
+#include <QFile>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <ios>
+#include <map>
+#include <mutex>
 #include <sstream>
-
-#include <boost/crc.hpp> 
+#include <vector>
 
 
 namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c) 
-    { 
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+    // ignore just line feed, all other characters including other whitespace are hashed
+    const char checksumIgnoreChar = '\r';
+
+    // slicing-by-8 tables for the reflected CRC-32 polynomial, same checksum as boost::crc_32_type
+    struct Crc32Tables
+    {
+      uint32_t table[8][256];
+
+      Crc32Tables()
+      {
+        for (uint32_t i = 0; i < 256; ++i){
+          uint32_t crc = i;
+          for (int j = 0; j < 8; ++j){
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+          }
+          table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i){
+          for (int k = 1; k < 8; ++k){
+            table[k][i] = (table[k-1][i] >> 8) ^ table[0][table[k-1][i] & 0xFF];
+          }
+        }
+      }
+    };
+
+    const Crc32Tables& crc32Tables()
+    {
+      static const Crc32Tables tables;
+      return tables;
+    }
+
+    uint32_t crc32Update(uint32_t crc, const unsigned char* data, size_t size)
+    {
+      const Crc32Tables& tables = crc32Tables();
+      const uint32_t (&t)[8][256] = tables.table;
+
+      while (size >= 8){
+        uint32_t one = (uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24)) ^ crc;
+        uint32_t two = uint32_t(data[4]) | (uint32_t(data[5]) << 8) | (uint32_t(data[6]) << 16) | (uint32_t(data[7]) << 24);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+              t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+        data += 8;
+        size -= 8;
+      }
+
+      while (size > 0){
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+        ++data;
+        --size;
+      }
+
+      return crc;
+    }
+
+    // update crc with data, skipping ignored characters without copying
+    uint32_t checksumUpdate(uint32_t crc, const char* data, size_t size)
+    {
+      const char* end = data + size;
+      while (data < end){
+        const char* ignored = static_cast<const char*>(std::memchr(data, checksumIgnoreChar, end - data));
+        const char* segmentEnd = ignored ? ignored : end;
+        crc = crc32Update(crc, reinterpret_cast<const unsigned char*>(data), segmentEnd - data);
+        data = ignored ? ignored + 1 : end;
+      }
+      return crc;
+    }
+
+    const uint32_t checksumInitial = 0xFFFFFFFFu;
+
+    std::string checksumToString(uint32_t crc)
+    {
+      char buffer[9];
+      std::snprintf(buffer, sizeof(buffer), "%08X", static_cast<unsigned>(crc ^ 0xFFFFFFFFu));
+      return std::string(buffer);
+    }
+
+    std::string checksumFileContents(const path& p)
+    {
+      uint32_t crc = checksumInitial;
+
+      // map the whole file if possible, otherwise fall back to reading it
+      QFile file(toQString(p));
+      if (file.open(QIODevice::ReadOnly)){
+        qint64 size = file.size();
+        if (size == 0){
+          return checksumToString(crc);
+        }
+        uchar* data = file.map(0, size);
+        if (data){
+          crc = checksumUpdate(crc, reinterpret_cast<const char*>(data), static_cast<size_t>(size));
+          file.unmap(data);
+          return checksumToString(crc);
+        }
+        file.close();
+      }
 
-      // ignore just line feed
-      bool result = (c == '\r');
+      openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
+      if (ifs){
+        return checksum(ifs);
+      }
 
-      return result;
+      return "00000000";
     }
+
+  }
+
+  namespace {
+
+    struct ChecksumCacheEntry
+    {
+      uintmax_t size;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    // checksums of files keyed by path, reused while the file's size and modification time are unchanged
+    std::mutex checksumCacheMutex;
+    bool checksumCacheEnabled = false;
+    std::map<path, ChecksumCacheEntry> checksumCache;
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    uint32_t crc = openstudio::detail::checksumUpdate(openstudio::detail::checksumInitial, s.data(), s.size());
+    return openstudio::detail::checksumToString(crc);
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    uint32_t crc = openstudio::detail::checksumInitial;
+
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(static_cast<size_t>(n));
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
+      is.read(buffer.data(), n);
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-      
-      crc.process_bytes(str.c_str(), stringSize);
+      crc = openstudio::detail::checksumUpdate(crc, buffer.data(), static_cast<size_t>(readSize));
     } while ( is );
-    
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
 
-    return result;
+    return openstudio::detail::checksumToString(crc);
   }
 
   /// return 8 character hex checksum of file contents
@@ -90,13 +195,55 @@ namespace openstudio {
   { 
     std::string result = "00000000";
     try{
-      openstudio::filesystem::ifstream  ifs(p, std::ios_base::binary );
-      if ( ifs ){
-        result = checksum(ifs);
+      if (!openstudio::filesystem::is_regular_file(p)){
+        openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
+        if ( ifs ){
+          result = checksum(ifs);
+        }
+        return result;
+      }
+
+      uintmax_t size = openstudio::filesystem::file_size(p);
+      std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p);
+
+      bool useCache;
+      {
+        std::lock_guard<std::mutex> lock(checksumCacheMutex);
+        useCache = checksumCacheEnabled;
+        auto it = checksumCache.find(p);
+        if (useCache && it != checksumCache.end() && it->second.size == size && it->second.lastWriteTime == lastWriteTime){
+          return it->second.checksum;
+        }
+      }
+
+      result = openstudio::detail::checksumFileContents(p);
+      if (!useCache){
+        return result;
+      }
+
+      std::lock_guard<std::mutex> lock(checksumCacheMutex);
+      if (checksumCacheEnabled){
+        ChecksumCacheEntry entry = {size, lastWriteTime, result};
+        checksumCache[p] = entry;
       }
     }catch(...){
     }
     return result;
   }
 
+  void setChecksumCacheEnabled(bool enabled)
+  {
+    std::lock_guard<std::mutex> lock(checksumCacheMutex);
+    checksumCacheEnabled = enabled;
+    if (!enabled){
+      checksumCache.clear();
+    }
+  }
+
+  void clearChecksumCache()
+  {
+    std::lock_guard<std::mutex> lock(checksumCacheMutex);
+    checksumCache.clear();
+  }
+
 } // openstudio
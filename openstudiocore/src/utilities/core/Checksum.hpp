@@ -46,6 +46,14 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /// cache checksums of regular files and reuse them until the file's size or last write time changes,
+  /// off by default since a file rewritten with the same size within the file system's time resolution
+  /// would return a stale checksum, disabling the cache clears it
+  UTILITIES_API void setChecksumCacheEnabled(bool enabled);
+
+  /// clear cached file checksums
+  UTILITIES_API void clearChecksumCache();
+
 } // openstudio
 
 
@@ -32,6 +32,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include <utility> // for std::pair
+#include <algorithm>
 #include <iostream>
 #include <vector> 
 #include <string> 
@@ -155,6 +156,32 @@ struct UTILITIES_API WorkspaceObjectNameGreater {
   bool operator()(const WorkspaceObject& a, const WorkspaceObject& b) const;
 };
 
+/** Sorts objects by name in the same order as WorkspaceObjectNameLess, but computes each upper
+ *  case name once rather than twice per comparison. Objects with equal names keep their relative
+ *  order. T must provide name() returning boost::optional<std::string>. */
+template<class T>
+void sortByName(std::vector<T>& objects) {
+  std::vector<std::pair<std::string, unsigned> > keys;
+  keys.reserve(objects.size());
+  for (unsigned i = 0; i < objects.size(); ++i) {
+    boost::optional<std::string> name = objects[i].name();
+    // upper case names compare the same as istringLess
+    keys.push_back(std::make_pair(name ? boost::to_upper_copy(*name) : std::string(), i));
+  }
+
+  std::stable_sort(keys.begin(), keys.end(),
+    [](const std::pair<std::string, unsigned>& a, const std::pair<std::string, unsigned>& b) {
+      return std::lexicographical_compare(a.first.begin(), a.first.end(), b.first.begin(), b.first.end());
+    });
+
+  std::vector<T> result;
+  result.reserve(objects.size());
+  for (const auto& key : keys) {
+    result.push_back(objects[key.second]);
+  }
+  objects.swap(result);
+}
+
 // sorts BCLComponents by name
 struct UTILITIES_API BCLComponentNameLess {
   bool operator()(const BCLComponent& a, const BCLComponent& b) const;
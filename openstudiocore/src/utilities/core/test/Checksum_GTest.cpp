@@ -31,12 +31,15 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Filesystem.hpp"
 
 #include <resources.hxx>
 
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
+using openstudio::clearChecksumCache;
+using openstudio::setChecksumCacheEnabled;
 using openstudio::createUUID;
 using openstudio::StringVector;
 using openstudio::toString;
@@ -112,6 +115,52 @@ TEST(Checksum, Paths)
   EXPECT_EQ("00000000", checksum(p));
 }
 
+TEST(Checksum, PathCache)
+{
+  path p = resourcesPath() / toPath("utilities/Checksum/ChecksumCache.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  // cache is off by default, same size rewrite is seen
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there";
+  }
+  EXPECT_EQ(checksum(string("HI there")), checksum(p));
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there";
+  }
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  setChecksumCacheEnabled(true);
+  EXPECT_EQ("1AD514BA", checksum(p));
+  EXPECT_EQ("1AD514BA", checksum(p));
+
+  // size changed, cached checksum is not used
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "Hi there\nGoodbye";
+  }
+  EXPECT_EQ("17B88D3A", checksum(p));
+
+  // same size and possibly same last write time, cache must be cleared
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary);
+    ofs << "HI there\nGoodbye";
+  }
+  clearChecksumCache();
+  EXPECT_EQ(checksum(string("HI there\nGoodbye")), checksum(p));
+
+  openstudio::filesystem::remove(p);
+  EXPECT_EQ("00000000", checksum(p));
+
+  setChecksumCacheEnabled(false);
+}
+
 TEST(Checksum, UUIDs) {
   StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
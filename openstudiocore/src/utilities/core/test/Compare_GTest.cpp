@@ -43,6 +43,8 @@ using openstudio::checkPtrVecEqual;
 using openstudio::firstOfPairEqual;
 using openstudio::secondOfPairEqual;
 using openstudio::VersionString;
+using openstudio::istringLess;
+using openstudio::sortByName;
 using std::shared_ptr;
 
 
@@ -144,6 +146,46 @@ TEST(Compare, IstringPairCompare)
   LOG_FREE(Info, "Compare", "Leaving IstringPairCompare")
 }
 
+namespace {
+
+  struct NamedThing {
+    boost::optional<std::string> m_name;
+    int m_id;
+    boost::optional<std::string> name() const { return m_name; }
+  };
+
+}
+
+TEST(Compare, SortByName)
+{
+  std::vector<NamedThing> things;
+  int id = 0;
+  for (const char* name : {"b", "A_2", "a_1", "B", "a2", "_z", "Zone 10", "zone 9", "", "Ab"}) {
+    NamedThing thing;
+    thing.m_name = std::string(name);
+    thing.m_id = id++;
+    things.push_back(thing);
+  }
+  NamedThing unnamed;
+  unnamed.m_id = id++;
+  things.push_back(unnamed);
+
+  std::vector<NamedThing> expected = things;
+  std::stable_sort(expected.begin(), expected.end(), [](const NamedThing& a, const NamedThing& b) {
+    return istringLess(a.m_name ? *a.m_name : std::string(), b.m_name ? *b.m_name : std::string());
+  });
+
+  sortByName(things);
+  ASSERT_EQ(expected.size(), things.size());
+  for (unsigned i = 0; i < things.size(); ++i) {
+    EXPECT_EQ(expected[i].m_id, things[i].m_id) << i;
+  }
+
+  // equal names keep their order
+  EXPECT_EQ("b", *things[6].m_name);
+  EXPECT_EQ("B", *things[7].m_name);
+}
+
 TEST(Compare, checkPtrVecEqual)
 {
   LOG_FREE(Info, "Compare", "Entering IstringPairCompare")
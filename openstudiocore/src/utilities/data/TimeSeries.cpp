@@ -477,6 +477,12 @@ long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const
   return value;
 }
 
+/// time in seconds from start of the first reporting interval
+std::vector<long> TimeSeries_Impl::secondsFromStart() const
+{
+  return m_secondsFromStart;
+}
+
 /// values
 Vector TimeSeries_Impl::values() const
 {
@@ -866,6 +872,11 @@ long TimeSeries::secondsFromFirstReport(const unsigned& i) const
   return m_impl->secondsFromFirstReport(i);
 }
 
+std::vector<long> TimeSeries::secondsFromStart() const
+{
+  return m_impl->secondsFromStart();
+}
+
 openstudio::Vector TimeSeries::values() const
 {
   return m_impl->values();
@@ -79,6 +79,8 @@ public:
 
   long secondsFromFirstReport(const unsigned& i) const;
 
+  std::vector<long> secondsFromStart() const;
+
   openstudio::Vector values() const;
 
   double values(const unsigned& i) const;
@@ -241,6 +243,9 @@ public:
   /// Return the time in seconds from end of the first reporting interval at index i to prevent implicit vector copy for single value
   long secondsFromFirstReport(const unsigned& i) const;
 
+  /// Returns the time in seconds from start of the first reporting interval, these are the end of each reporting interval
+  std::vector<long> secondsFromStart() const;
+
   /// Returns the values vector
   openstudio::Vector values() const;
 
@@ -34,12 +34,20 @@
 #include "Vector3d.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/System.hpp"
 
 #include <boost/math/constants/constants.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/thread.hpp>
 
 #include <polypartition/polypartition.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <list>
+#include <mutex>
+#include <unordered_map>
 
 namespace openstudio{
   /// convert degrees to radians
@@ -411,135 +419,272 @@ namespace openstudio{
     return point3d;
   }
 
-  std::vector<std::vector<Point3d> > computeTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
-  {
-    std::vector<std::vector<Point3d> > result;
+  namespace {
 
-    // check input
-    if (vertices.size () < 3){
-      return result;
-    }
+    struct TriangulationKeyHash
+    {
+      size_t operator()(const std::vector<double>& key) const
+      {
+        return boost::hash_range(key.begin(), key.end());
+      }
+    };
+
+    // keys of the cached triangulations, most recently used first
+    typedef std::list<const std::vector<double>*> TriangulationCacheOrder;
+
+    struct TriangulationCacheEntry
+    {
+      std::vector<std::vector<Point3d> > triangulation;
+      TriangulationCacheOrder::iterator order;
+    };
+
+    // triangulations keyed by the exact input coordinates, holes and tolerance, shared across models
+    std::mutex triangulationCacheMutex;
+    std::unordered_map<std::vector<double>, TriangulationCacheEntry, TriangulationKeyHash> triangulationCache;
+    TriangulationCacheOrder triangulationCacheOrder;
+
+    // the least recently used triangulation is evicted rather than growing without bound
+    const size_t maxTriangulationCacheSize = 10000;
+
+    // returns false if the input cannot be used as a key, e.g. if it has NaN coordinates
+    bool triangulationKey(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol, std::vector<double>& key)
+    {
+      size_t n = 2 + 3*vertices.size();
+      for (const std::vector<Point3d>& hole : holes){
+        n += 1 + 3*hole.size();
+      }
+      key.clear();
+      key.reserve(n);
+
+      key.push_back(tol);
+      key.push_back(vertices.size());
+      for (const Point3d& point : vertices){
+        key.push_back(point.x());
+        key.push_back(point.y());
+        key.push_back(point.z());
+      }
+      for (const std::vector<Point3d>& hole : holes){
+        key.push_back(hole.size());
+        for (const Point3d& point : hole){
+          key.push_back(point.x());
+          key.push_back(point.y());
+          key.push_back(point.z());
+        }
+      }
 
-    boost::optional<Vector3d> normal = getOutwardNormal(vertices);
-    if (!normal || normal->z() > -0.999){
-      return result;
+      return std::all_of(key.begin(), key.end(), [](double value){ return std::isfinite(value); });
     }
 
-    for (const auto& hole : holes){
-      normal = getOutwardNormal(hole);
+    // triangulation without the cache, see computeTriangulation
+    std::vector<std::vector<Point3d> > computeTriangulationUncached(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
+    {
+      std::vector<std::vector<Point3d> > result;
+
+      // check input
+      if (vertices.size () < 3){
+        return result;
+      }
+
+      boost::optional<Vector3d> normal = getOutwardNormal(vertices);
       if (!normal || normal->z() > -0.999){
         return result;
       }
-    }
 
-    std::vector<Point3d> allPoints;
+      for (const auto& hole : holes){
+        normal = getOutwardNormal(hole);
+        if (!normal || normal->z() > -0.999){
+          return result;
+        }
+      }
+
+      std::vector<Point3d> allPoints;
 
-    // PolyPartition does not support holes which intersect the polygon or share an edge
-    // if any hole is not fully contained we will use boost to remove all the holes
-    bool polyPartitionHoles = true;
-    for (const std::vector<Point3d>& hole : holes){
-      if (!within(hole, vertices, tol)){
-        // PolyPartition can't handle this
-        polyPartitionHoles = false;
-        break;
+      // PolyPartition does not support holes which intersect the polygon or share an edge
+      // if any hole is not fully contained we will use boost to remove all the holes
+      bool polyPartitionHoles = true;
+      for (const std::vector<Point3d>& hole : holes){
+        if (!within(hole, vertices, tol)){
+          // PolyPartition can't handle this
+          polyPartitionHoles = false;
+          break;
+        }
       }
-    }
 
-    if (!polyPartitionHoles){
-      // use boost to do all the intersections
-      std::vector<std::vector<Point3d> > allFaces = subtract(vertices, holes, tol);
-      std::vector<std::vector<Point3d> > noHoles;
-      for (const std::vector<Point3d>& face : allFaces){
-        std::vector<std::vector<Point3d> > temp = computeTriangulation(face, noHoles);
-        result.insert(result.end(), temp.begin(), temp.end());
+      if (!polyPartitionHoles){
+        // use boost to do all the intersections
+        std::vector<std::vector<Point3d> > allFaces = subtract(vertices, holes, tol);
+        std::vector<std::vector<Point3d> > noHoles;
+        for (const std::vector<Point3d>& face : allFaces){
+          std::vector<std::vector<Point3d> > temp = computeTriangulation(face, noHoles);
+          result.insert(result.end(), temp.begin(), temp.end());
+        }
+        return result;
       }
-      return result;
-    }
 
-    // convert input to vector of TPPLPoly
-    std::list<TPPLPoly> polys;
+      // convert input to vector of TPPLPoly
+      std::list<TPPLPoly> polys;
 
-    TPPLPoly outerPoly; // must be counter-clockwise, input vertices are clockwise
-    outerPoly.Init(vertices.size());
-    outerPoly.SetHole(false);
-    unsigned n = vertices.size();
-    for(unsigned i = 0; i < n; ++i){
+      TPPLPoly outerPoly; // must be counter-clockwise, input vertices are clockwise
+      outerPoly.Init(vertices.size());
+      outerPoly.SetHole(false);
+      unsigned n = vertices.size();
+      for(unsigned i = 0; i < n; ++i){
 
-      // should all have zero z coordinate now
-      double z = vertices[n-i-1].z();
-      if (abs(z) > tol){
-        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
-        return result;
+        // should all have zero z coordinate now
+        double z = vertices[n-i-1].z();
+        if (abs(z) > tol){
+          LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
+          return result;
+        }
+
+        Point3d point = getCombinedPoint(vertices[n-i-1], allPoints, tol);
+        outerPoly[i].x = point.x();
+        outerPoly[i].y = point.y();
       }
+      outerPoly.SetOrientation(TPPL_CCW);
+      polys.push_back(outerPoly);
 
-      Point3d point = getCombinedPoint(vertices[n-i-1], allPoints, tol);
-      outerPoly[i].x = point.x();
-      outerPoly[i].y = point.y();
-    }
-    outerPoly.SetOrientation(TPPL_CCW);
-    polys.push_back(outerPoly);
 
+      for (const std::vector<Point3d>& holeVertices : holes){
+
+        if (holeVertices.size () < 3){
+          LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Hole has fewer than 3 points, ignoring");
+          continue;
+        }
 
-    for (const std::vector<Point3d>& holeVertices : holes){
+        TPPLPoly innerPoly; // must be clockwise, input vertices are clockwise
+        innerPoly.Init(holeVertices.size());
+        innerPoly.SetHole(true);
+        //std::cout << "inner :";
+        for(unsigned i = 0; i < holeVertices.size(); ++i){
+
+          // should all have zero z coordinate now
+          double z = holeVertices[i].z();
+          if (abs(z) > tol){
+            LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
+            return result;
+          }
 
-      if (holeVertices.size () < 3){
-        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Hole has fewer than 3 points, ignoring");
-        continue;
+          Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
+          innerPoly[i].x = point.x();
+          innerPoly[i].y = point.y();
+        }
+        innerPoly.SetOrientation(TPPL_CW);
+        polys.push_back(innerPoly);
       }
 
-      TPPLPoly innerPoly; // must be clockwise, input vertices are clockwise
-      innerPoly.Init(holeVertices.size());
-      innerPoly.SetHole(true);
-      //std::cout << "inner :";
-      for(unsigned i = 0; i < holeVertices.size(); ++i){
+      // do partitioning
+      TPPLPartition pp;
+      std::list<TPPLPoly> resultPolys;
+      int test = pp.Triangulate_EC(&polys,&resultPolys);
+      if (test == 0){
+        test = pp.Triangulate_MONO(&polys, &resultPolys);
+      }
+      if (test == 0){
+        LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Failed to partition polygon");
+        return result;
+      }
 
-        // should all have zero z coordinate now
-        double z = holeVertices[i].z();
-        if (abs(z) > tol){
-          LOG_FREE(Error, "utilities.geometry.computeTriangulation", "All points must be on z = 0 plane for triangulation methods");
-          return result;
+      // convert back to vertices
+      std::list<TPPLPoly>::iterator it, itend;
+      //std::cout << "Start" << std::endl;
+      for(it = resultPolys.begin(), itend = resultPolys.end(); it != itend; ++it){
+
+        it->SetOrientation(TPPL_CW);
+
+        std::vector<Point3d> triangle;
+        for (long i = 0; i < it->GetNumPoints(); ++i){
+          TPPLPoint point = it->GetPoint(i);
+          triangle.push_back(Point3d(point.x, point.y, 0));
         }
+        //std::cout << triangle << std::endl;
+        result.push_back(triangle);
+      }
+      //std::cout << "End" << std::endl;
+
+      return result;
+    }
+
+  } // anonymous
 
-        Point3d point = getCombinedPoint(holeVertices[i], allPoints, tol);
-        innerPoly[i].x = point.x();
-        innerPoly[i].y = point.y();
+  std::vector<std::vector<Point3d> > computeTriangulation(const Point3dVector& vertices, const std::vector<std::vector<Point3d> >& holes, double tol)
+  {
+    std::vector<double> key;
+    bool useCache = triangulationKey(vertices, holes, tol, key);
+
+    if (useCache){
+      std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+      auto it = triangulationCache.find(key);
+      if (it != triangulationCache.end()){
+        triangulationCacheOrder.splice(triangulationCacheOrder.begin(), triangulationCacheOrder, it->second.order);
+        return it->second.triangulation;
       }
-      innerPoly.SetOrientation(TPPL_CW);
-      polys.push_back(innerPoly);
     }
 
-    // do partitioning
-    TPPLPartition pp;
-    std::list<TPPLPoly> resultPolys;
-    int test = pp.Triangulate_EC(&polys,&resultPolys);
-    if (test == 0){
-      test = pp.Triangulate_MONO(&polys, &resultPolys);
+    // computed without holding the lock so that other threads can triangulate at the same time
+    std::vector<std::vector<Point3d> > result = computeTriangulationUncached(vertices, holes, tol);
+
+    if (useCache){
+      std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+      // another thread may have added the same triangulation while this one was computing it
+      auto inserted = triangulationCache.insert(std::make_pair(std::move(key), TriangulationCacheEntry()));
+      if (inserted.second){
+        inserted.first->second.triangulation = result;
+        triangulationCacheOrder.push_front(&inserted.first->first);
+        inserted.first->second.order = triangulationCacheOrder.begin();
+
+        if (triangulationCache.size() > maxTriangulationCacheSize){
+          triangulationCache.erase(triangulationCache.find(*triangulationCacheOrder.back()));
+          triangulationCacheOrder.pop_back();
+        }
+      }
     }
-    if (test == 0){
-      LOG_FREE(Error, "utilities.geometry.computeTriangulation", "Failed to partition polygon");
+
+    return result;
+  }
+
+  std::vector<std::vector<std::vector<Point3d> > > computeTriangulations(const std::vector<std::vector<Point3d> >& vertices, const std::vector<std::vector<std::vector<Point3d> > >& holes, double tol, unsigned numThreads)
+  {
+    size_t numPolygons = vertices.size();
+    std::vector<std::vector<std::vector<Point3d> > > result(numPolygons);
+
+    if (!holes.empty() && (holes.size() != numPolygons)){
+      LOG_FREE(Error, "utilities.geometry.computeTriangulations", "Holes must be empty or have one entry per polygon");
       return result;
     }
 
-    // convert back to vertices
-    std::list<TPPLPoly>::iterator it, itend;
-    //std::cout << "Start" << std::endl;
-    for(it = resultPolys.begin(), itend = resultPolys.end(); it != itend; ++it){
-
-      it->SetOrientation(TPPL_CW);
+    const std::vector<std::vector<Point3d> > noHoles;
 
-      std::vector<Point3d> triangle;
-      for (long i = 0; i < it->GetNumPoints(); ++i){
-        TPPLPoint point = it->GetPoint(i);
-        triangle.push_back(Point3d(point.x, point.y, 0));
+    // each worker takes the next polygon until all are done, result is only written by the worker that took the polygon
+    std::atomic<size_t> nextPolygon(0);
+    auto worker = [&]() {
+      for (size_t i = nextPolygon++; i < numPolygons; i = nextPolygon++){
+        result[i] = computeTriangulation(vertices[i], holes.empty() ? noHoles : holes[i], tol);
       }
-      //std::cout << triangle << std::endl;
-      result.push_back(triangle);
+    };
+
+    if (numThreads == 0){
+      numThreads = System::numberOfProcessors();
+    }
+
+    size_t numWorkers = std::min<size_t>(std::max<unsigned>(numThreads, 1), numPolygons);
+    boost::thread_group threads;
+    for (size_t i = 1; i < numWorkers; ++i){
+      threads.create_thread(worker);
     }
-    //std::cout << "End" << std::endl;
+    worker();
+    threads.join_all();
 
     return result;
   }
 
+  void clearTriangulationCache()
+  {
+    std::lock_guard<std::mutex> lock(triangulationCacheMutex);
+    triangulationCache.clear();
+    triangulationCacheOrder.clear();
+  }
+
   std::vector<Point3d> moveVerticesTowardsPoint(const Point3dVector& vertices, const Point3d& point, double distance)
   {
     Point3dVector result;
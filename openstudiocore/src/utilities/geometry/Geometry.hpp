@@ -92,8 +92,16 @@ namespace openstudio{
 
   /// compute triangulation of vertices, holes are removed in the triangulation
   /// requires that vertices and holes are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed) 
+  /// results are cached by input geometry and tolerance, this function may be called from multiple threads
   UTILITIES_API std::vector<std::vector<Point3d> > computeTriangulation(const std::vector<Point3d>& vertices, const std::vector<std::vector<Point3d> >& holes, double tol = 0.001);
 
+  /// compute triangulation of many polygons in parallel, result i is the same as computeTriangulation(vertices[i], holes[i], tol)
+  /// holes may be empty if no polygon has holes, numThreads of zero uses one thread per processor
+  UTILITIES_API std::vector<std::vector<std::vector<Point3d> > > computeTriangulations(const std::vector<std::vector<Point3d> >& vertices, const std::vector<std::vector<std::vector<Point3d> > >& holes, double tol = 0.001, unsigned numThreads = 0);
+
+  /// clear triangulations cached by computeTriangulation
+  UTILITIES_API void clearTriangulationCache();
+
   /// move all vertices towards point by distance, pass negative distance to move away from point
   /// no guarantee that resulting polygon will be valid
   UTILITIES_API std::vector<Point3d> moveVerticesTowardsPoint(const std::vector<Point3d>& vertices, const Point3d& point, double distance);
@@ -10,6 +10,7 @@
   #include <utilities/geometry/Plane.hpp>
   #include <utilities/geometry/EulerAngles.hpp>
   #include <utilities/geometry/Geometry.hpp>
+  #include <utilities/geometry/PolygonBatch.hpp>
   #include <utilities/geometry/Transformation.hpp>
   #include <utilities/geometry/BoundingBox.hpp>
   #include <utilities/geometry/Intersection.hpp>
@@ -47,6 +48,7 @@
 // create an instantiation of the vector classes
 %template(Point3dVector) std::vector<openstudio::Point3d>;
 %template(Point3dVectorVector) std::vector<std::vector<openstudio::Point3d> >; // for polygon subtraction routines
+%template(Point3dVectorVectorVector) std::vector<std::vector<std::vector<openstudio::Point3d> > >; // for batch triangulation
 %template(PointLatLonVector) std::vector<openstudio::PointLatLon>;
 %template(Vector3dVector) std::vector<openstudio::Vector3d>;  
 %ignore std::vector<openstudio::Plane>::vector(size_type);
@@ -63,6 +65,7 @@
 %ignore std::vector<openstudio::ThreeMaterial>::vector(size_type);
 %ignore std::vector<openstudio::ThreeMaterial>::resize(size_type);
 %template(ThreeMaterialVector) std::vector<openstudio::ThreeMaterial>;
+%template(OptionalIntersectionResultVector) std::vector<boost::optional<openstudio::IntersectionResult> >;
 
 %ignore openstudio::operator<<;
 
@@ -72,6 +75,7 @@
 %include <utilities/geometry/Plane.hpp>
 %include <utilities/geometry/EulerAngles.hpp>
 %include <utilities/geometry/Geometry.hpp>
+%include <utilities/geometry/PolygonBatch.hpp>
 %include <utilities/geometry/Transformation.hpp>
 %include <utilities/geometry/BoundingBox.hpp>
 %include <utilities/geometry/Intersection.hpp>
@@ -28,6 +28,7 @@
 
 #include "Geometry.hpp"
 #include "Intersection.hpp"
+#include "BoundingBox.hpp"
 #include "../data/Matrix.hpp"
 #include "../core/Assert.hpp"
 #include "../core/Logger.hpp"
@@ -51,6 +52,9 @@ typedef boost::geometry::model::multi_polygon<BoostPolygon> BoostMultiPolygon;
 #include <polypartition/polypartition.h>
 
 #include <list>
+#include <map>
+#include <cmath>
+#include <limits>
 
 // remove_spikes 
 // adapted from https://github.com/boostorg/geometry/commits/develop/include/boost/geometry/algorithms/remove_spikes.hpp eb3260708eb241d8da337f4be73b41d69d33cd09
@@ -319,6 +323,326 @@ namespace openstudio{
 
   // Private implementation functions
 
+  // Combines points within tolerance in the same way as getCombinedPoint, the first point added within tol of a new
+  // point is returned in its place.  Once enough points have been added they are binned in a grid with cell size 2*tol
+  // so that only the neighboring cells need to be searched, large polygons would otherwise be quadratic in the number
+  // of vertices.  The cells are twice the tolerance so rounding in the cell computation can never hide a close point.
+  class PointSnapper
+  {
+  public:
+
+    PointSnapper(double tol)
+      : m_tol(tol), m_useGrid(false)
+    {}
+
+    Point3d getCombinedPoint(const Point3d& point3d)
+    {
+      if (!m_useGrid){
+        for (const Point3d& otherPoint : m_allPoints){
+          if (isClose(point3d, otherPoint)){
+            return otherPoint;
+          }
+        }
+        add(point3d);
+        return point3d;
+      }
+
+      GridCell cell;
+      if (!gridCell(point3d, cell)){
+        disableGrid();
+        return getCombinedPoint(point3d);
+      }
+
+      // find the earliest added point within tolerance, same answer as the linear search
+      bool found = false;
+      unsigned foundIndex = 0;
+      for (long long i = -1; i <= 1; ++i){
+        for (long long j = -1; j <= 1; ++j){
+          auto it = m_grid.find(GridCell(cell.first + i, cell.second + j));
+          if (it == m_grid.end()){
+            continue;
+          }
+          for (unsigned index : it->second){
+            if (found && (index >= foundIndex)){
+              break;
+            }
+            if (isClose(point3d, m_allPoints[index])){
+              found = true;
+              foundIndex = index;
+              break;
+            }
+          }
+        }
+      }
+
+      if (found){
+        return m_allPoints[foundIndex];
+      }
+
+      add(point3d);
+      return point3d;
+    }
+
+    // number of points added so far
+    unsigned size() const
+    {
+      return m_allPoints.size();
+    }
+
+    // forget all points added after the first n, allows reusing the points of one polygon for many others
+    void truncate(unsigned n)
+    {
+      while (m_allPoints.size() > n){
+        if (m_useGrid){
+          GridCell cell;
+          gridCell(m_allPoints.back(), cell);
+          auto it = m_grid.find(cell);
+          OS_ASSERT(it != m_grid.end());
+          it->second.pop_back();
+          if (it->second.empty()){
+            m_grid.erase(it);
+          }
+        }
+        m_allPoints.pop_back();
+      }
+    }
+
+  private:
+
+    typedef std::pair<long long, long long> GridCell;
+
+    bool isClose(const Point3d& point3d, const Point3d& otherPoint) const
+    {
+      return (std::sqrt(std::pow(point3d.x()-otherPoint.x(), 2) + std::pow(point3d.y()-otherPoint.y(), 2) + std::pow(point3d.z()-otherPoint.z(), 2)) < m_tol);
+    }
+
+    bool gridCell(const Point3d& point3d, GridCell& cell) const
+    {
+      double i = std::floor(point3d.x() / (2.0*m_tol));
+      double j = std::floor(point3d.y() / (2.0*m_tol));
+      if (!(std::abs(i) < 1.0e15) || !(std::abs(j) < 1.0e15)){
+        return false;
+      }
+      cell = GridCell(static_cast<long long>(i), static_cast<long long>(j));
+      return true;
+    }
+
+    void add(const Point3d& point3d)
+    {
+      m_allPoints.push_back(point3d);
+      if (m_useGrid){
+        GridCell cell;
+        if (gridCell(point3d, cell)){
+          m_grid[cell].push_back(m_allPoints.size() - 1);
+        }else{
+          disableGrid();
+        }
+      }else if ((m_allPoints.size() >= 32) && (m_tol > 0)){
+        enableGrid();
+      }
+    }
+
+    void enableGrid()
+    {
+      m_useGrid = true;
+      for (unsigned index = 0; index < m_allPoints.size(); ++index){
+        GridCell cell;
+        if (!gridCell(m_allPoints[index], cell)){
+          disableGrid();
+          return;
+        }
+        m_grid[cell].push_back(index);
+      }
+    }
+
+    void disableGrid()
+    {
+      m_useGrid = false;
+      m_grid.clear();
+    }
+
+    double m_tol;
+    bool m_useGrid;
+    std::vector<Point3d> m_allPoints;
+    std::map<GridCell, std::vector<unsigned> > m_grid;
+  };
+
+  namespace {
+
+    // Adaptive orientation predicates after Shewchuk, "Adaptive Precision Floating-Point Arithmetic and Fast Robust
+    // Geometric Predicates".  The floating point result is used when it is provably correct, otherwise the sign is
+    // computed exactly using error free transformations and expansion arithmetic.
+
+    const double epsilon = std::numeric_limits<double>::epsilon() / 2.0;
+
+    // a + b == x + y exactly
+    void twoSum(double a, double b, double& x, double& y)
+    {
+      x = a + b;
+      double bVirtual = x - a;
+      double aVirtual = x - bVirtual;
+      y = (a - aVirtual) + (b - bVirtual);
+    }
+
+    // a * b == x + y exactly
+    void twoProduct(double a, double b, double& x, double& y)
+    {
+      x = a * b;
+      y = std::fma(a, b, -x);
+    }
+
+    // adds b to the nonoverlapping expansion e, components stay in increasing order of magnitude
+    void growExpansion(std::vector<double>& e, double b)
+    {
+      double q = b;
+      for (double& component : e){
+        double sum;
+        twoSum(q, component, sum, component);
+        q = sum;
+      }
+      e.push_back(q);
+    }
+
+    // exact sign of the sum of terms
+    int exactSign(const std::vector<double>& terms)
+    {
+      std::vector<double> e;
+      e.reserve(terms.size());
+      for (double term : terms){
+        growExpansion(e, term);
+      }
+      for (auto it = e.rbegin(); it != e.rend(); ++it){
+        if (*it > 0.0){
+          return 1;
+        }else if (*it < 0.0){
+          return -1;
+        }
+      }
+      return 0;
+    }
+
+    int sign(double value)
+    {
+      return (value > 0.0) ? 1 : ((value < 0.0) ? -1 : 0);
+    }
+
+    // positive if a, b, c turn counterclockwise, negative if clockwise, zero if exactly collinear
+    int orient2d(const BoostPoint& a, const BoostPoint& b, const BoostPoint& c)
+    {
+      double detLeft = (a.x() - c.x()) * (b.y() - c.y());
+      double detRight = (a.y() - c.y()) * (b.x() - c.x());
+      double det = detLeft - detRight;
+      double errorBound = (3.0 + 16.0 * epsilon) * epsilon * (std::abs(detLeft) + std::abs(detRight));
+      if (std::abs(det) > errorBound){
+        return sign(det);
+      }
+
+      // each difference is exactly the sum of two doubles, so the determinant is exactly a sum of 16 products
+      double acx[2], bcy[2], acy[2], bcx[2];
+      twoSum(a.x(), -c.x(), acx[1], acx[0]);
+      twoSum(b.y(), -c.y(), bcy[1], bcy[0]);
+      twoSum(a.y(), -c.y(), acy[1], acy[0]);
+      twoSum(b.x(), -c.x(), bcx[1], bcx[0]);
+
+      std::vector<double> terms;
+      terms.reserve(16);
+      for (unsigned i = 0; i < 2; ++i){
+        for (unsigned j = 0; j < 2; ++j){
+          double x, y;
+          twoProduct(acx[i], bcy[j], x, y);
+          terms.push_back(x);
+          terms.push_back(y);
+          twoProduct(-acy[i], bcx[j], x, y);
+          terms.push_back(x);
+          terms.push_back(y);
+        }
+      }
+      return exactSign(terms);
+    }
+
+    // sign of the area of the closed ring, positive if counterclockwise, zero if the ring is degenerate
+    int orientation(const std::vector<BoostPoint>& points)
+    {
+      unsigned N = points.size();
+
+      double area = 0.0;
+      double magnitude = 0.0;
+      for (unsigned i = 0; i < N; ++i){
+        const BoostPoint& p = points[i];
+        const BoostPoint& q = points[(i + 1) % N];
+        area += p.x() * q.y() - q.x() * p.y();
+        magnitude += std::abs(p.x() * q.y()) + std::abs(q.x() * p.y());
+      }
+      // each product and each of the 2N - 1 additions contribute at most one rounding error
+      double errorBound = (2.0 * N + 2.0) * epsilon * magnitude;
+      if (std::abs(area) > errorBound){
+        return sign(area);
+      }
+
+      std::vector<double> terms;
+      terms.reserve(4 * N);
+      for (unsigned i = 0; i < N; ++i){
+        const BoostPoint& p = points[i];
+        const BoostPoint& q = points[(i + 1) % N];
+        double x, y;
+        twoProduct(p.x(), q.y(), x, y);
+        terms.push_back(x);
+        terms.push_back(y);
+        twoProduct(-q.x(), p.y(), x, y);
+        terms.push_back(x);
+        terms.push_back(y);
+      }
+      return exactSign(terms);
+    }
+
+    // true if b lies strictly between a and c on a line through all three
+    bool isPassThrough(const BoostPoint& a, const BoostPoint& b, const BoostPoint& c)
+    {
+      if (orient2d(a, b, c) != 0){
+        return false;
+      }
+      if (((a.x() == b.x()) && (a.y() == b.y())) || ((b.x() == c.x()) && (b.y() == c.y()))){
+        return false;
+      }
+      return (std::min(a.x(), c.x()) <= b.x()) && (b.x() <= std::max(a.x(), c.x())) &&
+             (std::min(a.y(), c.y()) <= b.y()) && (b.y() <= std::max(a.y(), c.y()));
+    }
+
+    // removes repeated points and points lying exactly on the line between their neighbors from a ring of combined
+    // points before it is clipped, these degenerate vertices are decided by floating point side tests inside boost
+    // and can make an otherwise valid ring fail, spikes are left to removeSpikes
+    std::vector<BoostPoint> removeDegenerateVertices(const std::vector<BoostPoint>& points)
+    {
+      std::vector<BoostPoint> result;
+      for (const BoostPoint& point : points){
+        if (!result.empty() && (result.back().x() == point.x()) && (result.back().y() == point.y())){
+          continue;
+        }
+        result.push_back(point);
+      }
+      while ((result.size() > 1) && (result.front().x() == result.back().x()) && (result.front().y() == result.back().y())){
+        result.pop_back();
+      }
+
+      // removing a point can make its previous neighbor pass through, so step back after each removal
+      unsigned i = 0;
+      while ((result.size() >= 3) && (i < result.size())){
+        unsigned N = result.size();
+        if (isPassThrough(result[(i + N - 1) % N], result[i], result[(i + 1) % N])){
+          result.erase(result.begin() + i);
+          if (i > 0){
+            --i;
+          }
+        }else{
+          ++i;
+        }
+      }
+
+      return result;
+    }
+
+  } // anonymous
+
   BoostPolygon removeSpikes(const BoostPolygon& polygon)
   {
     BoostPolygon temp(polygon);
@@ -419,7 +743,7 @@ namespace openstudio{
   }
 
   // convert a Point3d to a BoostPoint
-  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol)
+  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointSnapper& allPoints, double tol)
   {
     OS_ASSERT(abs(point3d.z()) <= tol);
 
@@ -427,19 +751,19 @@ namespace openstudio{
     //return boost::make_tuple(point3d.x(), point3d.y());
 
     // detailed method, try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
     return boost::make_tuple(resultPoint.x(), resultPoint.y());
   }
 
   // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointSnapper& allPoints, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
     }
 
-    BoostPolygon polygon;
+    std::vector<BoostPoint> points;
     for (const Point3d& vertex : vertices){
 
       // should all have zero z coordinate now
@@ -450,24 +774,33 @@ namespace openstudio{
       }
 
       // use helper method which combines close points
-      boost::geometry::append(polygon, boostPointFromPoint3d(vertex, allPoints, tol));
+      boost::tuple<double, double> point = boostPointFromPoint3d(vertex, allPoints, tol);
+      points.push_back(BoostPoint(point.get<0>(), point.get<1>()));
     }
 
-    // close polygon, use helper method which combines close points
-    boost::geometry::append(polygon, boostPointFromPoint3d(vertices[0], allPoints, tol));
-
-    //boost::geometry::correct(polygon);
+    points = removeDegenerateVertices(points);
+    if (points.size() < 3){
+      return boost::none;
+    }
 
-    boost::optional<double> testArea = boost::geometry::area(polygon);
-    if (!testArea || (*testArea < 0)){
+    // boost expects clockwise vertices, the sign is exact so nearly degenerate rings are not misjudged
+    if (orientation(points) >= 0){
       // DLM: we could offer to reverse these vertices here but that might not be the best idea
       return boost::none;
     }
 
+    BoostPolygon polygon;
+    for (const BoostPoint& point : points){
+      boost::geometry::append(polygon, point);
+    }
+
+    // close polygon
+    boost::geometry::append(polygon, points[0]);
+
     return polygon;
   }
 
-  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointSnapper& allPoints, double tol)
   {
     boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
     if (!result){
@@ -484,13 +817,13 @@ namespace openstudio{
   }
 
   // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointSnapper& allPoints, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
     }
 
-    BoostRing ring;
+    std::vector<BoostPoint> points;
     for (const Point3d& vertex : vertices){
 
       // should all have zero z coordinate now
@@ -501,24 +834,33 @@ namespace openstudio{
       }
 
       // use helper method which combines close points
-      boost::geometry::append(ring, boostPointFromPoint3d(vertex, allPoints, tol));
+      boost::tuple<double, double> point = boostPointFromPoint3d(vertex, allPoints, tol);
+      points.push_back(BoostPoint(point.get<0>(), point.get<1>()));
     }
 
-    // close polygon, use helper method which combines close points
-    boost::geometry::append(ring, boostPointFromPoint3d(vertices[0], allPoints, tol));
-
-    //boost::geometry::correct(ring);
+    points = removeDegenerateVertices(points);
+    if (points.size() < 3){
+      return boost::none;
+    }
 
-    boost::optional<double> testArea = boost::geometry::area(ring);
-    if (!testArea || (*testArea < 0)){
+    // boost expects clockwise vertices, the sign is exact so nearly degenerate rings are not misjudged
+    if (orientation(points) >= 0){
       // DLM: we could offer to reverse these vertices here but that might not be the best idea
       return boost::none;
     }
 
+    BoostRing ring;
+    for (const BoostPoint& point : points){
+      boost::geometry::append(ring, point);
+    }
+
+    // close polygon
+    boost::geometry::append(ring, points[0]);
+
     return ring;
   }
 
-  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointSnapper& allPoints, double tol)
   {
     boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
     if (!result){
@@ -535,7 +877,7 @@ namespace openstudio{
   }
 
   // convert a boost polygon to vertices
-  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointSnapper& allPoints, double tol)
   {
     std::vector<Point3d> result;
 
@@ -549,7 +891,7 @@ namespace openstudio{
       Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
       
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -575,7 +917,7 @@ namespace openstudio{
   }
 
   // convert a boost ring to vertices
-  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointSnapper& allPoints, double tol)
   {
     std::vector<Point3d> result;
 
@@ -584,7 +926,7 @@ namespace openstudio{
       Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = allPoints.getCombinedPoint(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -607,6 +949,19 @@ namespace openstudio{
     return result;
   }
 
+  // returns false if the polygons are too far apart to touch once points within tolerance are combined
+  bool boundingBoxesOverlap(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
+  {
+    BoundingBox boundingBox1;
+    boundingBox1.addPoints(polygon1);
+
+    BoundingBox boundingBox2;
+    boundingBox2.addPoints(polygon2);
+
+    // each point may move by up to tol when combined
+    return boundingBox1.intersects(boundingBox2, 2.0*tol);
+  }
+
   // struct used to sort polygons in descending order by area
   struct BoostPolygonAreaGreater{
     bool operator()(const BoostPolygon& left, const BoostPolygon& right){
@@ -655,7 +1010,7 @@ namespace openstudio{
   std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
     
     boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
     if (!boostPolygon){
@@ -672,7 +1027,7 @@ namespace openstudio{
   bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
     
     boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
     if (!boostPolygon){
@@ -704,8 +1059,13 @@ namespace openstudio{
 
   boost::optional<std::vector<Point3d> > join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
+    // polygons which are further apart than the tolerance cannot be joined
+    if (!boundingBoxesOverlap(polygon1, polygon2, tol)){
+      return boost::none;
+    }
+
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
     
     boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
     if (!boostPolygon1){
@@ -774,11 +1134,20 @@ namespace openstudio{
       return polygons;
     }
 
+    // bounding boxes are computed once to skip pairs which are far apart
+    std::vector<BoundingBox> boundingBoxes(N);
+    for (unsigned i = 0; i < N; ++i){
+      boundingBoxes[i].addPoints(polygons[i]);
+    }
+
     // compute adjacency matrix
     Matrix A(N,N,0.0);
     for (unsigned i = 0; i < polygons.size(); ++i){
       A(i,i) = 1.0;
       for (unsigned j = i+1; j < polygons.size(); ++j){
+        if (!boundingBoxes[i].intersects(boundingBoxes[j], 2.0*tol)){
+          continue;
+        }
         if (join(polygons[i], polygons[j], tol)){
           A(i,j) = 1.0;
           A(j,i) = 1.0;
@@ -809,30 +1178,18 @@ namespace openstudio{
     return result;
   }
 
-  boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
+  // intersect two boost rings which have already been converted using allPoints, see intersect
+  boost::optional<IntersectionResult> intersectBoostRings(const BoostRing& boostPolygon1, const BoostRing& boostPolygon2, PointSnapper& allPoints, double tol)
   {
     std::vector<Point3d> resultPolygon1;
     std::vector<Point3d> resultPolygon2;
     std::vector< std::vector<Point3d> > newPolygons1;
     std::vector< std::vector<Point3d> > newPolygons2;
 
-    // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
-    
-    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
-    if (!boostPolygon1){
-      return boost::none;
-    }
-
-    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
-    if (!boostPolygon2){
-      return boost::none;
-    }
-
     // intersect the points in face coordinates, 
     std::vector<BoostPolygon> intersectionResult;
     try{
-      boost::geometry::intersection(*boostPolygon1, *boostPolygon2, intersectionResult);
+      boost::geometry::intersection(boostPolygon1, boostPolygon2, intersectionResult);
     }catch(const boost::geometry::overlay_invalid_input_exception&){
       LOG_FREE(Error, "utilities.geometry.intersect", "overlay_invalid_input_exception");
       return boost::none;
@@ -908,7 +1265,7 @@ namespace openstudio{
 
     // polygon1 minus polygon2
     std::vector<BoostPolygon> differenceResult1;
-    boost::geometry::difference(*boostPolygon1, *boostPolygon2, differenceResult1);
+    boost::geometry::difference(boostPolygon1, boostPolygon2, differenceResult1);
     differenceResult1 = removeSpikes(differenceResult1);
     differenceResult1 = removeHoles(differenceResult1);
     
@@ -937,7 +1294,7 @@ namespace openstudio{
 
     // polygon2 minus polygon1
     std::vector<BoostPolygon> differenceResult2;
-    boost::geometry::difference(*boostPolygon2, *boostPolygon1, differenceResult2);
+    boost::geometry::difference(boostPolygon2, boostPolygon1, differenceResult2);
     differenceResult2 = removeSpikes(differenceResult2);
     differenceResult2 = removeHoles(differenceResult2);
 
@@ -967,12 +1324,73 @@ namespace openstudio{
     return IntersectionResult(resultPolygon1, resultPolygon2, newPolygons1, newPolygons2);
   }
 
+  boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
+  {
+    // polygons which are further apart than the tolerance cannot intersect even after combining points
+    if (!boundingBoxesOverlap(polygon1, polygon2, tol)){
+      return boost::none;
+    }
+
+    // convert vertices to boost rings
+    PointSnapper allPoints(tol);
+    
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
+    if (!boostPolygon1){
+      return boost::none;
+    }
+
+    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
+    if (!boostPolygon2){
+      return boost::none;
+    }
+
+    return intersectBoostRings(*boostPolygon1, *boostPolygon2, allPoints, tol);
+  }
+
+  std::vector<boost::optional<IntersectionResult> > intersect(const std::vector<Point3d>& polygon1, const std::vector<std::vector<Point3d> >& polygons2, double tol)
+  {
+    std::vector<boost::optional<IntersectionResult> > result(polygons2.size());
+
+    // convert polygon1 once, each of polygons2 is then combined with the points of polygon1 only
+    // so that each result is the same as calling intersect(polygon1, polygon2, tol)
+    PointSnapper allPoints(tol);
+
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
+    if (!boostPolygon1){
+      return result;
+    }
+    unsigned numPoints1 = allPoints.size();
+
+    BoundingBox boundingBox1;
+    boundingBox1.addPoints(polygon1);
+
+    for (unsigned i = 0; i < polygons2.size(); ++i){
+
+      BoundingBox boundingBox2;
+      boundingBox2.addPoints(polygons2[i]);
+      if (!boundingBox1.intersects(boundingBox2, 2.0*tol)){
+        continue;
+      }
+
+      allPoints.truncate(numPoints1);
+
+      boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygons2[i], allPoints, tol);
+      if (!boostPolygon2){
+        continue;
+      }
+
+      result[i] = intersectBoostRings(*boostPolygon1, *boostPolygon2, allPoints, tol);
+    }
+
+    return result;
+  }
+
   std::vector<std::vector<Point3d> > subtract(const std::vector<Point3d>& polygon, const std::vector<std::vector<Point3d> >& holes, double tol)
   {
     std::vector<std::vector<Point3d> > result;
 
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
 
     boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
     if (!initialBoostPolygon){
@@ -1009,7 +1427,7 @@ namespace openstudio{
   bool selfIntersects(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
 
     boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
     if (bp){
@@ -1022,7 +1440,7 @@ namespace openstudio{
   bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
 
     boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
     boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
@@ -1044,7 +1462,7 @@ namespace openstudio{
   bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper allPoints(tol);
 
     if (geometry1.size() == 1){
       if (geometry1[0].z() > tol){
@@ -79,6 +79,10 @@ namespace openstudio{
 
   /// intersect two polygons, requires that all vertices are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed) 
   UTILITIES_API boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol);
+
+  /// intersect one polygon with many others, requires that all vertices are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed) 
+  /// result i is the same as intersect(polygon1, polygons2[i], tol), polygon1 is only converted once and polygons whose bounding boxes do not overlap polygon1 are skipped
+  UTILITIES_API std::vector<boost::optional<IntersectionResult> > intersect(const std::vector<Point3d>& polygon1, const std::vector<std::vector<Point3d> >& polygons2, double tol);
   
   /// subtract all holes from polygon, requires that all vertices are in clockwise order on the z = 0 plane (i.e. in face coordinates but reversed) 
   UTILITIES_API std::vector<std::vector<Point3d> > subtract(const std::vector<Point3d>& polygon, const std::vector<std::vector<Point3d> >& holes, double tol);
@@ -0,0 +1,226 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+#include "PolygonBatch.hpp"
+
+#include "Point3d.hpp"
+#include "Vector3d.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace openstudio{
+
+  PolygonBatch::PolygonBatch(const std::vector<std::vector<Point3d> >& polygons)
+  {
+    unsigned numVertices = 0;
+    for (const std::vector<Point3d>& polygon : polygons){
+      numVertices += polygon.size();
+    }
+
+    m_offsets.reserve(polygons.size() + 1);
+    m_x.reserve(numVertices);
+    m_y.reserve(numVertices);
+    m_z.reserve(numVertices);
+
+    m_offsets.push_back(0);
+    for (const std::vector<Point3d>& polygon : polygons){
+      for (const Point3d& point : polygon){
+        m_x.push_back(point.x());
+        m_y.push_back(point.y());
+        m_z.push_back(point.z());
+      }
+      m_offsets.push_back(m_x.size());
+    }
+
+    compute();
+  }
+
+  unsigned PolygonBatch::numPolygons() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  std::vector<Point3d> PolygonBatch::vertices(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    std::vector<Point3d> result;
+    result.reserve(m_offsets[index + 1] - m_offsets[index]);
+    for (unsigned i = m_offsets[index]; i < m_offsets[index + 1]; ++i){
+      result.push_back(Point3d(m_x[i], m_y[i], m_z[i]));
+    }
+    return result;
+  }
+
+  boost::optional<double> PolygonBatch::area(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    if (m_offsets[index + 1] - m_offsets[index] < 3){
+      return boost::none;
+    }
+    return m_areas[index];
+  }
+
+  boost::optional<Vector3d> PolygonBatch::newallVector(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    if (m_offsets[index + 1] - m_offsets[index] < 3){
+      return boost::none;
+    }
+    return Vector3d(m_newallX[index], m_newallY[index], m_newallZ[index]);
+  }
+
+  boost::optional<Vector3d> PolygonBatch::outwardNormal(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    if (std::isnan(m_normalX[index])){
+      return boost::none;
+    }
+    return Vector3d(m_normalX[index], m_normalY[index], m_normalZ[index]);
+  }
+
+  boost::optional<Point3d> PolygonBatch::centroid(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    if (std::isnan(m_centroidX[index])){
+      return boost::none;
+    }
+    return Point3d(m_centroidX[index], m_centroidY[index], m_centroidZ[index]);
+  }
+
+  const std::vector<double>& PolygonBatch::areas() const
+  {
+    return m_areas;
+  }
+
+  const std::vector<double>& PolygonBatch::tilts() const
+  {
+    return m_tilts;
+  }
+
+  const std::vector<double>& PolygonBatch::azimuths() const
+  {
+    return m_azimuths;
+  }
+
+  void PolygonBatch::compute()
+  {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double pi = boost::math::constants::pi<double>();
+
+    unsigned n = numPolygons();
+    m_newallX.assign(n, 0.0);
+    m_newallY.assign(n, 0.0);
+    m_newallZ.assign(n, 0.0);
+    m_normalX.assign(n, nan);
+    m_normalY.assign(n, nan);
+    m_normalZ.assign(n, nan);
+    m_centroidX.assign(n, nan);
+    m_centroidY.assign(n, nan);
+    m_centroidZ.assign(n, nan);
+    m_areas.assign(n, 0.0);
+    m_tilts.assign(n, nan);
+    m_azimuths.assign(n, nan);
+
+    const double* x = m_x.data();
+    const double* y = m_y.data();
+    const double* z = m_z.data();
+
+    for (unsigned p = 0; p < n; ++p){
+      unsigned begin = m_offsets[p];
+      unsigned end = m_offsets[p + 1];
+      if (end - begin < 3){
+        continue;
+      }
+
+      // Newall vector, same operations in the same order as getNewallVector
+      double x0 = x[begin];
+      double y0 = y[begin];
+      double z0 = z[begin];
+      double nx = 0.0;
+      double ny = 0.0;
+      double nz = 0.0;
+      for (unsigned i = begin + 1; i < end - 1; ++i){
+        double v1x = x[i] - x0;
+        double v1y = y[i] - y0;
+        double v1z = z[i] - z0;
+        double v2x = x[i + 1] - x0;
+        double v2y = y[i + 1] - y0;
+        double v2z = z[i + 1] - z0;
+        nx += (v1y*v2z - v1z*v2y);
+        ny += (v1z*v2x - v1x*v2z);
+        nz += (v1x*v2y - v1y*v2x);
+      }
+      m_newallX[p] = nx;
+      m_newallY[p] = ny;
+      m_newallZ[p] = nz;
+
+      Vector3d normal(nx, ny, nz);
+      m_areas[p] = normal.length() / 2.0;
+      if (!normal.normalize()){
+        continue;
+      }
+      m_normalX[p] = normal.x();
+      m_normalY[p] = normal.y();
+      m_normalZ[p] = normal.z();
+
+      m_tilts[p] = std::acos(std::max(-1.0, std::min(1.0, normal.z())));
+      double rawAngle = std::acos(std::max(-1.0, std::min(1.0, normal.y())));
+      m_azimuths[p] = (normal.x() < 0.0) ? (2.0*pi - rawAngle) : rawAngle;
+
+      // centroid, triangle fan about the first vertex weighted by signed triangle area
+      double weight = 0.0;
+      double cx = 0.0;
+      double cy = 0.0;
+      double cz = 0.0;
+      for (unsigned i = begin + 1; i < end - 1; ++i){
+        double v1x = x[i] - x0;
+        double v1y = y[i] - y0;
+        double v1z = z[i] - z0;
+        double v2x = x[i + 1] - x0;
+        double v2y = y[i + 1] - y0;
+        double v2z = z[i + 1] - z0;
+        double w = (v1y*v2z - v1z*v2y)*normal.x() + (v1z*v2x - v1x*v2z)*normal.y() + (v1x*v2y - v1y*v2x)*normal.z();
+        weight += w;
+        cx += w*(x0 + x[i] + x[i + 1]);
+        cy += w*(y0 + y[i] + y[i + 1]);
+        cz += w*(z0 + z[i] + z[i + 1]);
+      }
+      if (weight > 0.0){
+        m_centroidX[p] = cx / (3.0*weight);
+        m_centroidY[p] = cy / (3.0*weight);
+        m_centroidZ[p] = cz / (3.0*weight);
+      }
+    }
+  }
+
+} // openstudio
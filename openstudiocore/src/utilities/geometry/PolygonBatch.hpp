@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+#ifndef UTILITIES_GEOMETRY_POLYGONBATCH_HPP
+#define UTILITIES_GEOMETRY_POLYGONBATCH_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+namespace openstudio{
+
+  // forward declaration
+  class Point3d;
+  class Vector3d;
+
+  /** PolygonBatch computes the geometry of many polygons in one pass. The vertices of all polygons
+   *  are packed into contiguous x, y and z arrays, and the results are stored in one array per
+   *  quantity, so that model wide queries do not convert and allocate per polygon. Results agree
+   *  with getArea, getNewallVector, getOutwardNormal and getCentroid for each planar polygon.
+   */
+  class UTILITIES_API PolygonBatch{
+  public:
+
+    /// packs the vertices of polygons and computes their geometry
+    PolygonBatch(const std::vector<std::vector<Point3d> >& polygons);
+
+    /// number of polygons in the batch
+    unsigned numPolygons() const;
+
+    /// vertices of polygon index
+    std::vector<Point3d> vertices(unsigned index) const;
+
+    /// gross area of polygon index, empty if it has fewer than three vertices, same as getArea
+    boost::optional<double> area(unsigned index) const;
+
+    /// Newall vector of polygon index, same as getNewallVector
+    boost::optional<Vector3d> newallVector(unsigned index) const;
+
+    /// outward normal of polygon index, same as getOutwardNormal
+    boost::optional<Vector3d> outwardNormal(unsigned index) const;
+
+    /// centroid of polygon index, same as getCentroid
+    boost::optional<Point3d> centroid(unsigned index) const;
+
+    /// areas of all polygons, 0 for polygons with fewer than three vertices
+    const std::vector<double>& areas() const;
+
+    /// angle between outward normal and up of all polygons (radians), NaN if there is no outward normal
+    const std::vector<double>& tilts() const;
+
+    /// angle measured clockwise from North to outward normal of all polygons (radians), NaN if there is no outward normal
+    const std::vector<double>& azimuths() const;
+
+  private:
+
+    void compute();
+
+    // polygon i has vertices m_offsets[i] to m_offsets[i+1]-1
+    std::vector<unsigned> m_offsets;
+    std::vector<double> m_x;
+    std::vector<double> m_y;
+    std::vector<double> m_z;
+
+    std::vector<double> m_newallX;
+    std::vector<double> m_newallY;
+    std::vector<double> m_newallZ;
+    std::vector<double> m_normalX;
+    std::vector<double> m_normalY;
+    std::vector<double> m_normalZ;
+    std::vector<double> m_centroidX;
+    std::vector<double> m_centroidY;
+    std::vector<double> m_centroidZ;
+    std::vector<double> m_areas;
+    std::vector<double> m_tilts;
+    std::vector<double> m_azimuths;
+  };
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POLYGONBATCH_HPP
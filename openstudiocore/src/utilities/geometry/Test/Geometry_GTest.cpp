@@ -714,6 +714,95 @@ TEST_F(GeometryFixture, Triangulate_Up)
   EXPECT_TRUE(checkNormals(normal, test));
 }
 
+TEST_F(GeometryFixture, Triangulate_Cached)
+{
+  double tol = 0.01;
+  Vector3d normal(0, 0, -1);
+
+  clearTriangulationCache();
+
+  std::vector<std::vector<Point3d> > holes;
+  holes.push_back(makeRectangleDown(1, 1, 1, 1));
+
+  std::vector<std::vector<Point3d> > test1 = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, tol);
+  EXPECT_FALSE(test1.empty());
+  EXPECT_DOUBLE_EQ(15.0, totalArea(test1));
+
+  // same result from the cache
+  std::vector<std::vector<Point3d> > test2 = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, tol);
+  EXPECT_EQ(test1, test2);
+
+  // different tolerance or holes are different inputs
+  test2 = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, 0.001);
+  EXPECT_DOUBLE_EQ(15.0, totalArea(test2));
+  test2 = computeTriangulation(makeRectangleDown(0, 0, 4, 4), std::vector<std::vector<Point3d> >(), tol);
+  EXPECT_DOUBLE_EQ(16.0, totalArea(test2));
+
+  // failures are cached too
+  test2 = computeTriangulation(makeRectangleUp(0, 0, 4, 4), holes, tol);
+  EXPECT_TRUE(test2.empty());
+  test2 = computeTriangulation(makeRectangleUp(0, 0, 4, 4), holes, tol);
+  EXPECT_TRUE(test2.empty());
+
+  clearTriangulationCache();
+  test2 = computeTriangulation(makeRectangleDown(0, 0, 4, 4), holes, tol);
+  EXPECT_EQ(test1, test2);
+  EXPECT_TRUE(checkNormals(normal, test2));
+}
+
+TEST_F(GeometryFixture, Triangulate_Parallel)
+{
+  double tol = 0.01;
+  Vector3d normal(0, 0, -1);
+
+  std::vector<std::vector<Point3d> > allVertices;
+  std::vector<std::vector<std::vector<Point3d> > > allHoles;
+  for (unsigned i = 0; i < 50; ++i){
+    std::vector<std::vector<Point3d> > holes;
+    allVertices.push_back(makeRectangleDown(i, 0, 4, 4));
+    if (i % 2 == 0){
+      // hole in middle
+      holes.push_back(makeRectangleDown(i + 1, 1, 1, 1));
+    } else{
+      // hole on edge
+      holes.push_back(makeRectangleDown(i + 1, 0, 1, 1));
+    }
+    allHoles.push_back(holes);
+  }
+  allVertices.push_back(makeRectangleUp(0, 0, 4, 4));
+  allHoles.push_back(std::vector<std::vector<Point3d> >());
+
+  for (unsigned numThreads = 1; numThreads <= 4; ++numThreads){
+    clearTriangulationCache();
+
+    std::vector<std::vector<std::vector<Point3d> > > test = computeTriangulations(allVertices, allHoles, tol, numThreads);
+    ASSERT_EQ(allVertices.size(), test.size());
+    for (unsigned i = 0; i < allVertices.size(); ++i){
+      EXPECT_EQ(computeTriangulation(allVertices[i], allHoles[i], tol), test[i]);
+    }
+    for (unsigned i = 0; i < 50; ++i){
+      EXPECT_DOUBLE_EQ(15.0, totalArea(test[i]));
+      EXPECT_TRUE(checkNormals(normal, test[i]));
+    }
+    EXPECT_TRUE(test[50].empty());
+  }
+
+  // no holes
+  std::vector<std::vector<std::vector<Point3d> > > test = computeTriangulations(allVertices, std::vector<std::vector<std::vector<Point3d> > >(), tol);
+  ASSERT_EQ(allVertices.size(), test.size());
+  for (unsigned i = 0; i < 50; ++i){
+    EXPECT_DOUBLE_EQ(16.0, totalArea(test[i]));
+  }
+
+  // holes must match vertices
+  allHoles.pop_back();
+  test = computeTriangulations(allVertices, allHoles, tol);
+  ASSERT_EQ(allVertices.size(), test.size());
+  for (const auto& triangulation : test){
+    EXPECT_TRUE(triangulation.empty());
+  }
+}
+
 TEST_F(GeometryFixture, PointLatLon)
 {
   // building in Portland
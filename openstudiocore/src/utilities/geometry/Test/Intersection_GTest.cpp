@@ -38,6 +38,8 @@
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
+#include <algorithm>
+
 typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
 typedef boost::geometry::model::ring<BoostPoint> BoostRing;
@@ -1325,4 +1327,196 @@ TEST_F(GeometryFixture, selfIntersects)
   points.push_back(Point3d(2, 0, 0));
   points.push_back(Point3d(0, 0, 0));
   EXPECT_TRUE(selfIntersects(points,tol));
-}
\ No newline at end of file
+}
+
+TEST_F(GeometryFixture, Intersect_Batch)
+{
+  double tol = 0.01;
+
+  // corpus of cases from the tests above, each should give the same result in batch as pairwise
+  Point3dVector points1 = makeRectangleDown(0, 0, 2, 1);
+
+  std::vector<Point3dVector> polygons2;
+  polygons2.push_back(makeRectangleDown(1, 0, 2, 1)); // overlap
+  polygons2.push_back(makeRectangleDown(2, 0, 1, 1)); // adjacent
+  polygons2.push_back(makeRectangleDown(0.5, 0.25, 0.5, 0.5)); // within
+  polygons2.push_back(makeRectangleDown(0, 0, 2, 1)); // same points
+  polygons2.push_back(makeRectangleDown(0.005, 0.005, 2, 1)); // same points within tolerance
+  polygons2.push_back(makeRectangleUp(1, 0, 2, 1)); // wrong sense
+  polygons2.push_back(makeRectangleDown(10, 10, 1, 1)); // far away
+  polygons2.push_back(Point3dVector()); // empty
+
+  std::vector<boost::optional<IntersectionResult> > results = intersect(points1, polygons2, tol);
+  ASSERT_EQ(polygons2.size(), results.size());
+
+  for (unsigned i = 0; i < polygons2.size(); ++i){
+    boost::optional<IntersectionResult> test = intersect(points1, polygons2[i], tol);
+    ASSERT_EQ(static_cast<bool>(test), static_cast<bool>(results[i])) << i;
+    if (test){
+      EXPECT_EQ(test->polygon1(), results[i]->polygon1()) << i;
+      EXPECT_EQ(test->polygon2(), results[i]->polygon2()) << i;
+      EXPECT_EQ(test->newPolygons1(), results[i]->newPolygons1()) << i;
+      EXPECT_EQ(test->newPolygons2(), results[i]->newPolygons2()) << i;
+    }
+  }
+
+  EXPECT_TRUE(results[0]);
+  EXPECT_FALSE(results[1]);
+  EXPECT_TRUE(results[2]);
+  EXPECT_TRUE(results[3]);
+  EXPECT_TRUE(results[4]);
+  EXPECT_FALSE(results[5]);
+  EXPECT_FALSE(results[6]);
+  EXPECT_FALSE(results[7]);
+
+  // bad first polygon
+  results = intersect(Point3dVector(), polygons2, tol);
+  ASSERT_EQ(polygons2.size(), results.size());
+  for (const auto& result : results){
+    EXPECT_FALSE(result);
+  }
+}
+
+TEST_F(GeometryFixture, Intersect_ManyVertices)
+{
+  double tol = 0.01;
+
+  // floor plate with a stepped edge, enough vertices that close points are found using a grid
+  unsigned N = 100;
+  Point3dVector points1;
+  points1.push_back(Point3d(0, 0, 0));
+  for (unsigned i = 0; i < N; ++i){
+    double h = (i % 2 == 0) ? 1.0 : 1.5;
+    points1.push_back(Point3d(i, h, 0));
+    points1.push_back(Point3d(i + 1, h, 0));
+  }
+  points1.push_back(Point3d(N, 0, 0));
+  ASSERT_TRUE(getArea(points1));
+  EXPECT_DOUBLE_EQ(125.0, getArea(points1).get());
+
+  // covers the first half of the floor plate
+  Point3dVector points2 = makeRectangleDown(-1, -1, 51, 3);
+
+  boost::optional<IntersectionResult> test = intersect(points1, points2, tol);
+  ASSERT_TRUE(test);
+  ASSERT_TRUE(getArea(test->polygon1()));
+  EXPECT_NEAR(62.5, getArea(test->polygon1()).get(), tol);
+  EXPECT_NEAR(62.5, totalArea(test->newPolygons1()), tol);
+
+  std::vector<Point3dVector> polygons2;
+  polygons2.push_back(points2);
+  polygons2.push_back(points1);
+  std::vector<boost::optional<IntersectionResult> > results = intersect(points1, polygons2, tol);
+  ASSERT_EQ(2u, results.size());
+  ASSERT_TRUE(results[0]);
+  EXPECT_EQ(test->polygon1(), results[0]->polygon1());
+  EXPECT_EQ(test->newPolygons1(), results[0]->newPolygons1());
+  EXPECT_EQ(test->newPolygons2(), results[0]->newPolygons2());
+
+  // intersecting with itself leaves the floor plate unchanged
+  ASSERT_TRUE(results[1]);
+  EXPECT_NEAR(125.0, getArea(results[1]->polygon1()).get(), tol);
+  EXPECT_EQ(0, results[1]->newPolygons1().size());
+  EXPECT_EQ(0, results[1]->newPolygons2().size());
+}
+
+TEST_F(GeometryFixture, Intersect_Degenerate)
+{
+  double tol = 0.01;
+
+  boost::optional<IntersectionResult> test;
+  Point3dVector points1;
+  Point3dVector points2;
+
+  // all vertices on a line
+  points1.push_back(Point3d(0, 0, 0));
+  points1.push_back(Point3d(1, 0, 0));
+  points1.push_back(Point3d(2, 0, 0));
+  points2 = makeRectangleDown(0, -1, 2, 2);
+
+  test = intersect(points1, points2, tol);
+  EXPECT_FALSE(test);
+
+  test = intersect(points2, points1, tol);
+  EXPECT_FALSE(test);
+
+  // all vertices combine into one point
+  points1 = makeRectangleDown(0, 0, 0.001, 0.001);
+
+  test = intersect(points1, points2, tol);
+  EXPECT_FALSE(test);
+
+  // repeated vertex and a vertex in the middle of an edge give the same result as the plain rectangle
+  points1.clear();
+  points1.push_back(Point3d(2, 1, 0));
+  points1.push_back(Point3d(2, 0.5, 0));
+  points1.push_back(Point3d(2, 0, 0));
+  points1.push_back(Point3d(0, 0, 0));
+  points1.push_back(Point3d(0, 0, 0));
+  points1.push_back(Point3d(0, 1, 0));
+  points2 = makeRectangleDown(1, 0, 2, 1);
+
+  test = intersect(points1, points2, tol);
+  ASSERT_TRUE(test);
+  EXPECT_TRUE(circularEqual(makeRectangleDown(1, 0, 1, 1), test->polygon1())) << test->polygon1();
+  EXPECT_TRUE(circularEqual(makeRectangleDown(1, 0, 1, 1), test->polygon2())) << test->polygon2();
+  ASSERT_EQ(1, test->newPolygons1().size());
+  EXPECT_TRUE(circularEqual(makeRectangleDown(0, 0, 1, 1), test->newPolygons1()[0])) << test->newPolygons1()[0];
+  ASSERT_EQ(1, test->newPolygons2().size());
+  EXPECT_TRUE(circularEqual(makeRectangleDown(2, 0, 1, 1), test->newPolygons2()[0])) << test->newPolygons2()[0];
+}
+
+TEST_F(GeometryFixture, Intersect_NearCollinear)
+{
+  double tol = 0.01;
+
+  boost::optional<IntersectionResult> test;
+  Point3dVector points1;
+  Point3dVector points2;
+
+  // vertex a tiny distance off the shared edge of two adjacent rectangles
+  points1.push_back(Point3d(1, 1, 0));
+  points1.push_back(Point3d(1, 0, 0));
+  points1.push_back(Point3d(0, 0, 0));
+  points1.push_back(Point3d(0, 1, 0));
+  points1.push_back(Point3d(0.5, 1 + 1.0e-12, 0));
+  points2 = makeRectangleDown(0, 1, 1, 1);
+
+  test = intersect(points1, points2, tol);
+  EXPECT_FALSE(test);
+
+  test = intersect(points2, points1, tol);
+  EXPECT_FALSE(test);
+
+  // sliver whose orientation is decided by a 1e-12 offset, clockwise and counterclockwise
+  points1.clear();
+  points1.push_back(Point3d(0, 0, 0));
+  points1.push_back(Point3d(1, 1.0e-12, 0));
+  points1.push_back(Point3d(2, 0, 0));
+  points2 = makeRectangleDown(0, -1, 2, 2);
+
+  test = intersect(points1, points2, tol);
+  EXPECT_FALSE(test);
+
+  std::reverse(points1.begin(), points1.end());
+  test = intersect(points1, points2, tol);
+  EXPECT_FALSE(test);
+
+  // far from the origin, the vertex on the hypotenuse is only collinear up to rounding
+  double x = 1.0e5;
+  points1.clear();
+  points1.push_back(Point3d(x, 0, 0));
+  points1.push_back(Point3d(x, 2, 0));
+  points1.push_back(Point3d(x + 2.0 / 3.0, 2.0 - 2.0 / 3.0, 0));
+  points1.push_back(Point3d(x + 2, 0, 0));
+  ASSERT_TRUE(getArea(points1));
+  EXPECT_NEAR(2.0, getArea(points1).get(), tol);
+  points2 = makeRectangleDown(x, 0, 1, 0.5);
+
+  test = intersect(points1, points2, tol);
+  ASSERT_TRUE(test);
+  ASSERT_TRUE(getArea(test->polygon1()));
+  EXPECT_NEAR(0.5, getArea(test->polygon1()).get(), tol);
+  EXPECT_NEAR(1.5, totalArea(test->newPolygons1()), tol);
+  EXPECT_EQ(0, test->newPolygons2().size());
+}
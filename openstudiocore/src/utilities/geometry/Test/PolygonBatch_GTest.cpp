@@ -0,0 +1,145 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PolygonBatch.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PolygonBatch)
+{
+  std::vector<std::vector<Point3d> > polygons;
+
+  // empty polygon
+  polygons.push_back(std::vector<Point3d>());
+
+  // south wall
+  std::vector<Point3d> points;
+  points.push_back(Point3d(0,0,1));
+  points.push_back(Point3d(0,0,0));
+  points.push_back(Point3d(1,0,0));
+  points.push_back(Point3d(1,0,1));
+  polygons.push_back(points);
+
+  // west wall
+  points.clear();
+  points.push_back(Point3d(3,100,2));
+  points.push_back(Point3d(3,100,1));
+  points.push_back(Point3d(3,0,1));
+  points.push_back(Point3d(3,0,2));
+  polygons.push_back(points);
+
+  // L shaped roof
+  points.clear();
+  points.push_back(Point3d(0,2,1));
+  points.push_back(Point3d(0,0,1));
+  points.push_back(Point3d(2,0,1));
+  points.push_back(Point3d(2,1,1));
+  points.push_back(Point3d(1,1,1));
+  points.push_back(Point3d(1,2,1));
+  polygons.push_back(points);
+
+  // collinear points
+  points.clear();
+  points.push_back(Point3d(0,0,0));
+  points.push_back(Point3d(1,0,0));
+  points.push_back(Point3d(2,0,0));
+  polygons.push_back(points);
+
+  PolygonBatch batch(polygons);
+  ASSERT_EQ(5u, batch.numPolygons());
+  ASSERT_EQ(5u, batch.areas().size());
+  ASSERT_EQ(5u, batch.tilts().size());
+  ASSERT_EQ(5u, batch.azimuths().size());
+
+  for (unsigned i = 0; i < polygons.size(); ++i){
+    EXPECT_EQ(polygons[i], batch.vertices(i));
+
+    boost::optional<double> area = getArea(polygons[i]);
+    ASSERT_EQ(area.is_initialized(), batch.area(i).is_initialized());
+    if (area){
+      EXPECT_EQ(*area, *batch.area(i));
+      EXPECT_EQ(*area, batch.areas()[i]);
+    }
+
+    boost::optional<Vector3d> newall = getNewallVector(polygons[i]);
+    ASSERT_EQ(newall.is_initialized(), batch.newallVector(i).is_initialized());
+    if (newall){
+      EXPECT_EQ(newall->x(), batch.newallVector(i)->x());
+      EXPECT_EQ(newall->y(), batch.newallVector(i)->y());
+      EXPECT_EQ(newall->z(), batch.newallVector(i)->z());
+    }
+
+    boost::optional<Vector3d> normal = getOutwardNormal(polygons[i]);
+    ASSERT_EQ(normal.is_initialized(), batch.outwardNormal(i).is_initialized());
+    if (normal){
+      EXPECT_EQ(normal->x(), batch.outwardNormal(i)->x());
+      EXPECT_EQ(normal->y(), batch.outwardNormal(i)->y());
+      EXPECT_EQ(normal->z(), batch.outwardNormal(i)->z());
+    }else{
+      EXPECT_TRUE(std::isnan(batch.tilts()[i]));
+      EXPECT_TRUE(std::isnan(batch.azimuths()[i]));
+    }
+
+    boost::optional<Point3d> centroid = getCentroid(polygons[i]);
+    ASSERT_EQ(centroid.is_initialized(), batch.centroid(i).is_initialized());
+    if (centroid){
+      EXPECT_NEAR(centroid->x(), batch.centroid(i)->x(), 1.0E-12);
+      EXPECT_NEAR(centroid->y(), batch.centroid(i)->y(), 1.0E-12);
+      EXPECT_NEAR(centroid->z(), batch.centroid(i)->z(), 1.0E-12);
+    }
+  }
+
+  double pi = boost::math::constants::pi<double>();
+
+  EXPECT_DOUBLE_EQ(1.0, batch.areas()[1]);
+  EXPECT_DOUBLE_EQ(pi/2.0, batch.tilts()[1]);
+  EXPECT_DOUBLE_EQ(pi, batch.azimuths()[1]);
+
+  EXPECT_DOUBLE_EQ(100.0, batch.areas()[2]);
+  EXPECT_DOUBLE_EQ(pi/2.0, batch.tilts()[2]);
+  EXPECT_DOUBLE_EQ(3.0*pi/2.0, batch.azimuths()[2]);
+
+  EXPECT_DOUBLE_EQ(3.0, batch.areas()[3]);
+  EXPECT_DOUBLE_EQ(0.0, batch.tilts()[3]);
+  EXPECT_DOUBLE_EQ(5.0/6.0, batch.centroid(3)->x());
+  EXPECT_DOUBLE_EQ(5.0/6.0, batch.centroid(3)->y());
+  EXPECT_DOUBLE_EQ(1.0, batch.centroid(3)->z());
+
+  EXPECT_EQ(0.0, batch.areas()[0]);
+  EXPECT_EQ(0.0, batch.areas()[4]);
+  EXPECT_FALSE(batch.centroid(4));
+}
@@ -467,18 +467,17 @@ std::ostream& IdfFile::print(std::ostream& os) const {
   return os;
 }
 
-bool IdfFile::save(const openstudio::path& p, bool overwrite) {
+openstudio::path IdfFile::savePath(const openstudio::path& p, const boost::optional<IddFileType>& iddFileType) {
 
   // default extension
   std::string expectedExtension;
   bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
-  if (iddType) {
-    if (*iddType == IddFileType::EnergyPlus) { 
+  if (iddFileType) {
+    if (*iddFileType == IddFileType::EnergyPlus) { 
       expectedExtension = "idf"; 
       enforceExtension = true;
     }
-    else if (*iddType == IddFileType::OpenStudio) {
+    else if (*iddFileType == IddFileType::OpenStudio) {
       std::string ext = getFileExtension(p);
       if (ext == componentFileExtension()) {
         expectedExtension = componentFileExtension();
@@ -497,6 +496,13 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
     wp = setFileExtension(p,expectedExtension,false,true);
   }
 
+  return wp;
+}
+
+bool IdfFile::save(const openstudio::path& p, bool overwrite) {
+
+  path wp = savePath(p, m_iddFileAndFactoryWrapper.iddFileType());
+
   // do not overwrite if not allowed
   if (!overwrite) {
     path temp = completePathToFile(wp,path());
@@ -225,6 +225,9 @@ class UTILITIES_API IdfFile {
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
+  /// path that save writes to, p with the extension expected for iddFileType
+  static openstudio::path savePath(const openstudio::path& p, const boost::optional<IddFileType>& iddFileType);
  private:
 
   std::string m_header;
@@ -77,7 +77,7 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()), 
+      m_fields(other.m_fields), 
       m_fieldComments(other.fieldComments())
   {
     if (keepHandle){
@@ -144,7 +144,7 @@ namespace detail {
   IdfObject_Impl::IdfObject_Impl(const Handle& handle,
                                  const std::string& comment, 
                                  const IddObject& iddObject, 
-                                 const StringVector& fields,
+                                 const CopyOnWriteStrings& fields,
                                  const StringVector& fieldComments) 
     : m_handle(handle),    
       m_comment(comment),
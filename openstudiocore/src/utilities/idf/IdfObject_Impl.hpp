@@ -45,6 +45,7 @@
 #include <string>
 #include <ostream>
 #include <vector>
+#include <memory>
 
 namespace openstudio { 
 
@@ -61,6 +62,56 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail { 
 
+  /** Field storage for IdfObject_Impl. Copies share a single vector of strings, which is only
+   *  duplicated when a copy is first accessed through a non-const member. Cloning a Workspace
+   *  or taking an idfObject() of a WorkspaceObject therefore does not copy field data for
+   *  objects that are never edited afterwards. */
+  class CopyOnWriteStrings {
+   public:
+    typedef std::vector<std::string>::size_type size_type;
+
+    CopyOnWriteStrings() : m_data(std::make_shared<std::vector<std::string> >()) {}
+
+    CopyOnWriteStrings(const std::vector<std::string>& values)
+      : m_data(std::make_shared<std::vector<std::string> >(values))
+    {}
+
+    operator const std::vector<std::string>&() const { return *m_data; }
+
+    size_type size() const { return m_data->size(); }
+
+    bool empty() const { return m_data->empty(); }
+
+    const std::string& operator[](size_type index) const { return (*m_data)[index]; }
+
+    std::string& operator[](size_type index) { return mutableData()[index]; }
+
+    const std::string& back() const { return m_data->back(); }
+
+    std::string& back() { return mutableData().back(); }
+
+    void push_back(const std::string& value) { mutableData().push_back(value); }
+
+    void pop_back() { mutableData().pop_back(); }
+
+    void resize(size_type n) {
+      if (n != m_data->size()) { mutableData().resize(n); }
+    }
+
+    /** Returns true if this and other currently share storage. */
+    bool sharesDataWith(const CopyOnWriteStrings& other) const { return m_data == other.m_data; }
+
+   private:
+    std::vector<std::string>& mutableData() {
+      if (m_data.use_count() > 1) {
+        m_data = std::make_shared<std::vector<std::string> >(*m_data);
+      }
+      return *m_data;
+    }
+
+    std::shared_ptr<std::vector<std::string> > m_data;
+  };
+
   /** Implementation of IdfObject. */
   class UTILITIES_API IdfObject_Impl : public std::enable_shared_from_this<IdfObject_Impl>, 
                                        public Nano::Observer {
@@ -82,7 +133,7 @@ namespace detail {
     IdfObject_Impl(const Handle& handle,
                    const std::string& comment,
                    const IddObject& iddObject,
-                   const StringVector& fields,
+                   const CopyOnWriteStrings& fields,
                    const StringVector& fieldComments);
 
     virtual ~IdfObject_Impl() {}
@@ -405,7 +456,7 @@ namespace detail {
     IddObject m_iddObject;
 
     // idf fields
-    std::vector<std::string> m_fields;
+    CopyOnWriteStrings m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
@@ -43,7 +43,10 @@ ObjectOrderBase::ObjectOrderBase(bool directOrder) : m_orderByIddEnum(!directOrd
 
 ObjectOrderBase::ObjectOrderBase(const IddObjectTypeVector& iddOrder) :
     m_orderByIddEnum(false),
-    m_iddOrder(iddOrder) {}
+    m_iddOrder(iddOrder)
+{
+  updateRanks();
+}
 
 // GETTERS AND SETTERS
 
@@ -54,6 +57,7 @@ bool ObjectOrderBase::orderByIddEnum() const {
 void ObjectOrderBase::setOrderByIddEnum() {
   m_iddOrder = boost::none;
   m_orderByIddEnum = true;
+  updateRanks();
 }
 
 boost::optional<IddObjectTypeVector> ObjectOrderBase::iddOrder() const {
@@ -63,11 +67,13 @@ boost::optional<IddObjectTypeVector> ObjectOrderBase::iddOrder() const {
 void ObjectOrderBase::setIddOrder(const IddObjectTypeVector& order) {
   m_iddOrder = order;
   m_orderByIddEnum = false;
+  updateRanks();
 }
 
 bool ObjectOrderBase::push_back(IddObjectType type) {
   if (!m_iddOrder) { return false; }
   m_iddOrder->push_back(type);
+  updateRanks();
   return true;
 }
 
@@ -75,6 +81,7 @@ bool ObjectOrderBase::insert(IddObjectType type, IddObjectType insertBeforeType)
   if (!m_iddOrder) { return false; }
   auto it = getIterator(insertBeforeType);
   m_iddOrder->insert(it,type);
+  updateRanks();
   return true;
 }
 
@@ -86,6 +93,7 @@ bool ObjectOrderBase::insert(IddObjectType type, unsigned index) {
     m_iddOrder->insert(it,type);
   }
   else { m_iddOrder->push_back(type); }
+  updateRanks();
   return true;
 }
 
@@ -98,6 +106,7 @@ bool ObjectOrderBase::move(IddObjectType type, IddObjectType insertBeforeType) {
   if (type == insertBeforeType) { return true; }
   // erase type
   m_iddOrder->erase(it);
+  updateRanks();
   // reinsert at given location
   return insert(type,insertBeforeType);
 }
@@ -111,6 +120,7 @@ bool ObjectOrderBase::move(IddObjectType type, unsigned index) {
   if ((it - m_iddOrder->begin()) == static_cast<int>(index)) { return true; }
   // erase type
   m_iddOrder->erase(it);
+  updateRanks();
   // reinsert at given index
   return insert(type,index);
 }
@@ -124,6 +134,7 @@ bool ObjectOrderBase::swap(IddObjectType type1, IddObjectType type2) {
   if (it1 == it2) { return true; }
   *it1 = type2;
   *it2 = type1;
+  updateRanks();
   return true;
 }
 
@@ -132,12 +143,14 @@ bool ObjectOrderBase::erase(IddObjectType type) {
   auto it = getIterator(type);
   if (it == m_iddOrder->end()) { return false; }
   m_iddOrder->erase(it);
+  updateRanks();
   return true;
 }
 
 void ObjectOrderBase::setDirectOrder() {
   m_orderByIddEnum = false;
   m_iddOrder = boost::none;
+  updateRanks();
 }
 
 // SORTING
@@ -148,7 +161,7 @@ bool ObjectOrderBase::less(IddObjectType left, IddObjectType right) const {
   }
   else {
     OS_ASSERT(m_iddOrder);
-    return (getIterator(left) < getIterator(right));
+    return (rank(left) < rank(right));
   }
 }
 
@@ -165,8 +178,7 @@ bool ObjectOrderBase::less(boost::optional<IddObjectType> left,
 bool ObjectOrderBase::inOrder(const IddObjectType& type) const {
   if (m_orderByIddEnum) { return true; }
   if (m_iddOrder) {
-    auto it = getIterator(type);
-    if (it != m_iddOrder->end()) { return true; }
+    return (rank(type) < m_iddOrder->size());
   }
   return false;
 }
@@ -174,8 +186,7 @@ bool ObjectOrderBase::inOrder(const IddObjectType& type) const {
 OptionalUnsigned ObjectOrderBase::indexInOrder(const IddObjectType& type) const {
   if (m_orderByIddEnum) { return static_cast<unsigned>(type.value()); }
   if (m_iddOrder) { 
-    auto it = getIterator(type);
-    return (it - m_iddOrder->begin());
+    return rank(type);
   }
   return boost::none;
 }
@@ -185,12 +196,38 @@ OptionalUnsigned ObjectOrderBase::indexInOrder(const IddObjectType& type) const
 // assumes that m_iddOrder == true
 IddObjectTypeVector::iterator ObjectOrderBase::getIterator(const IddObjectType& type) {
   OS_ASSERT(m_iddOrder);
-  return std::find(m_iddOrder->begin(),m_iddOrder->end(),type);
+  return m_iddOrder->begin() + rank(type);
 }
 
 IddObjectTypeVector::const_iterator ObjectOrderBase::getIterator(const IddObjectType& type) const {
   OS_ASSERT(m_iddOrder);
-  return std::find(m_iddOrder->begin(),m_iddOrder->end(),type);
+  return m_iddOrder->begin() + rank(type);
+}
+
+unsigned ObjectOrderBase::rank(const IddObjectType& type) const {
+  OS_ASSERT(m_iddOrder);
+  unsigned value = static_cast<unsigned>(type.value());
+  if ((value < m_ranks.size()) && (m_ranks[value] < m_iddOrder->size())) {
+    return m_ranks[value];
+  }
+  return m_iddOrder->size();
+}
+
+void ObjectOrderBase::updateRanks() {
+  m_ranks.clear();
+  if (!m_iddOrder) { return; }
+
+  unsigned n = m_iddOrder->size();
+  for (unsigned i = 0; i < n; ++i) {
+    unsigned value = static_cast<unsigned>((*m_iddOrder)[i].value());
+    if (value >= m_ranks.size()) {
+      m_ranks.resize(value + 1, n);
+    }
+    // keep the first occurrence, as std::find would
+    if (m_ranks[value] == n) {
+      m_ranks[value] = i;
+    }
+  }
 }
 
 } // openstudio
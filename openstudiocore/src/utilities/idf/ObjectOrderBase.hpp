@@ -133,8 +133,18 @@ class UTILITIES_API ObjectOrderBase {
   IddObjectTypeVector::iterator getIterator(const IddObjectType& type);
   IddObjectTypeVector::const_iterator getIterator(const IddObjectType& type) const;
 
+  /** Returns the index of the first occurrence of type in m_iddOrder, or m_iddOrder->size() if
+   *  type is not listed. Assumes m_iddOrder is initialized. */
+  unsigned rank(const IddObjectType& type) const;
+
+  /** Must be called whenever m_iddOrder is changed. */
+  void updateRanks();
+
  private:
 
+  // rank of each IddObjectType in m_iddOrder, indexed by IddObjectType::value()
+  std::vector<unsigned> m_ranks;
+
   REGISTER_LOGGER("utilities.idf.ObjectOrderBase");
 };
 
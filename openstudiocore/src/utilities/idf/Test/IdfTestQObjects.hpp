@@ -37,6 +37,8 @@
 
 #include <boost/optional.hpp>
 
+#include <vector>
+
 using namespace openstudio;
 
 class WorkspaceReciever  {
@@ -96,4 +98,44 @@ class WorkspaceReciever  {
 
 };
 
+class WorkspaceChangeCounter : public Nano::Observer {
+ public:
+
+  WorkspaceChangeCounter(const Workspace& workspace)
+    : numWorkspaceChanges(0), numObjectChanges(0), numObjectDataChanges(0), numEditTransactionEnds(0)
+  {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = workspace.getImpl<openstudio::detail::Workspace_Impl>();
+    impl->Workspace_Impl::onChange.connect<WorkspaceChangeCounter, &WorkspaceChangeCounter::workspaceChange>(this);
+    impl->Workspace_Impl::onEditTransactionEnd.connect<WorkspaceChangeCounter, &WorkspaceChangeCounter::editTransactionEnd>(this);
+  }
+
+  void watch(const WorkspaceObject& object)
+  {
+    std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+    impl->WorkspaceObject_Impl::onChange.connect<WorkspaceChangeCounter, &WorkspaceChangeCounter::objectChange>(this);
+    impl->WorkspaceObject_Impl::onDataChange.connect<WorkspaceChangeCounter, &WorkspaceChangeCounter::objectDataChange>(this);
+  }
+
+  unsigned numWorkspaceChanges;
+  unsigned numObjectChanges;
+  unsigned numObjectDataChanges;
+  unsigned numEditTransactionEnds;
+  std::vector<Handle> editTransactionHandles;
+
+ public:
+
+  void workspaceChange() { ++numWorkspaceChanges; }
+
+  void objectChange() { ++numObjectChanges; }
+
+  void objectDataChange() { ++numObjectDataChanges; }
+
+  void editTransactionEnd(const std::vector<Handle>& handles)
+  {
+    ++numEditTransactionEnds;
+    editTransactionHandles = handles;
+  }
+
+};
+
 #endif // UTILITIES_IDF_TEST_IDFTESTQOBJECTS_HPP
@@ -183,3 +183,26 @@ TEST_F(IdfFixture,ObjectOrderBase_ManipulateIddObjectTypeOrder) {
   EXPECT_FALSE(success);
   EXPECT_TRUE(orderer.iddOrder()->size() < n);
 }
+
+TEST_F(IdfFixture,ObjectOrderBase_DuplicateIddObjectTypes) {
+  IddObjectTypeVector order;
+  order.push_back(openstudio::IddObjectType::Lights);    // 0
+  order.push_back(openstudio::IddObjectType::Zone);      // 1
+  order.push_back(openstudio::IddObjectType::Lights);    // 2
+  order.push_back(openstudio::IddObjectType::Building);  // 3
+
+  // first occurrence of a type determines its position
+  ObjectOrderBase orderer(order);
+  EXPECT_EQ(static_cast<unsigned>(0),*(orderer.indexInOrder(openstudio::IddObjectType::Lights)));
+  EXPECT_TRUE(orderer.less(openstudio::IddObjectType::Lights,openstudio::IddObjectType::Zone));
+
+  // erasing the first occurrence exposes the second
+  EXPECT_TRUE(orderer.erase(openstudio::IddObjectType::Lights));
+  EXPECT_EQ(static_cast<unsigned>(1),*(orderer.indexInOrder(openstudio::IddObjectType::Lights)));
+  EXPECT_TRUE(orderer.less(openstudio::IddObjectType::Zone,openstudio::IddObjectType::Lights));
+  EXPECT_TRUE(orderer.inOrder(openstudio::IddObjectType::Lights));
+
+  EXPECT_TRUE(orderer.erase(openstudio::IddObjectType::Lights));
+  EXPECT_FALSE(orderer.inOrder(openstudio::IddObjectType::Lights));
+  EXPECT_EQ(static_cast<unsigned>(2),*(orderer.indexInOrder(openstudio::IddObjectType::Lights)));
+}
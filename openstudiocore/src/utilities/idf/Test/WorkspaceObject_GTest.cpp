@@ -489,3 +489,37 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources)
   sourcesVector = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
   EXPECT_EQ(1, sourcesVector.size());
 }
+
+TEST_F(IdfFixture, WorkspaceObject_CachedPointers)
+{
+  Workspace ws;
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanOutletNodeName,node2->handle()));
+
+  // resolve once to fill in the direct pointers
+  EXPECT_EQ(2u, spm->targets().size());
+  ASSERT_EQ(1u, node->sources().size());
+  EXPECT_EQ(spm->handle(), node->sources()[0].handle());
+
+  // a clone copies the pointer sets, but must resolve into its own objects
+  Workspace clone = ws.clone(true);
+  OptionalWorkspaceObject cloneSpm = clone.getObject(spm->handle());
+  ASSERT_TRUE(cloneSpm);
+  OptionalWorkspaceObject cloneNode = cloneSpm->getTarget(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName);
+  ASSERT_TRUE(cloneNode);
+  EXPECT_EQ(node->handle(), cloneNode->handle());
+  EXPECT_TRUE(cloneNode->workspace() == clone);
+  EXPECT_FALSE(cloneNode->workspace() == ws);
+  ASSERT_EQ(1u, cloneNode->sources().size());
+  EXPECT_TRUE(cloneNode->sources()[0].workspace() == clone);
+
+  // removing a target must not leave a stale direct pointer behind
+  EXPECT_FALSE(node2->remove().empty());
+  EXPECT_FALSE(spm->getTarget(OS_SetpointManager_MixedAirFields::FanOutletNodeName));
+  EXPECT_EQ(1u, spm->targets().size());
+  EXPECT_EQ(2u, cloneSpm->targets().size());
+}
@@ -95,6 +95,32 @@ TEST_F(IdfFixture, IdfFile_Workspace_Roundtrip)
   copyOfIdfFile.print(outFile); outFile.close();
 }
 
+TEST_F(IdfFixture, Workspace_SaveStreamsObjects)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+
+  // streaming print matches printing a full IdfFile copy
+  std::stringstream expected;
+  workspace.toIdfFile().print(expected);
+  std::stringstream actual;
+  actual << workspace;
+  EXPECT_EQ(expected.str(), actual.str());
+
+  openstudio::path outPath = outDir/toPath("savedWorkspace.idf");
+  if (openstudio::filesystem::exists(outPath)) {
+    openstudio::filesystem::remove(outPath);
+  }
+  EXPECT_TRUE(workspace.save(outPath));
+  EXPECT_TRUE(openstudio::filesystem::exists(outPath));
+  EXPECT_FALSE(openstudio::filesystem::exists(outDir/toPath("savedWorkspace.idf.tmp")));
+  EXPECT_FALSE(workspace.save(outPath));
+  EXPECT_TRUE(workspace.save(outPath,true));
+
+  OptionalIdfFile loaded = IdfFile::load(outPath,IddFileType::EnergyPlus);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(workspace.numObjects(), loaded->objects().size());
+}
+
 TEST_F(IdfFixture, ObjectHasURL)
 {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
@@ -539,6 +565,38 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneKeepHandlesIsIndependent) {
+  // cloned objects share field data with the original until one side is edited
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  WorkspaceObjectVector wsObjects = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(wsObjects.empty());
+  EXPECT_TRUE(wsObjects[0].setString(ZoneFields::XOrigin,"0.0"));
+  std::string originalName = wsObjects[0].name().get();
+
+  Workspace clone = workspace.clone(true);
+
+  OptionalWorkspaceObject cloneZone = clone.getObject(wsObjects[0].handle());
+  ASSERT_TRUE(cloneZone);
+  EXPECT_EQ(originalName, cloneZone->name().get());
+
+  // edit the clone
+  EXPECT_TRUE(cloneZone->setString(ZoneFields::XOrigin,"10.0"));
+  EXPECT_EQ("10.0", cloneZone->getString(ZoneFields::XOrigin).get());
+  EXPECT_EQ("0.0", wsObjects[0].getString(ZoneFields::XOrigin).get());
+
+  // edit the original
+  EXPECT_TRUE(wsObjects[0].setName("Edited Original Zone"));
+  EXPECT_EQ("Edited Original Zone", wsObjects[0].name().get());
+  EXPECT_EQ(originalName, cloneZone->name().get());
+
+  // idfObject snapshots are independent of later edits too
+  IdfObject snapshot = cloneZone->idfObject();
+  EXPECT_TRUE(cloneZone->setString(ZoneFields::XOrigin,"20.0"));
+  EXPECT_EQ("10.0", snapshot.getString(ZoneFields::XOrigin).get());
+  EXPECT_TRUE(snapshot.setString(ZoneFields::XOrigin,"30.0"));
+  EXPECT_EQ("20.0", cloneZone->getString(ZoneFields::XOrigin).get());
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -1953,6 +2011,118 @@ TEST_F(IdfFixture, Workspace_AddObjects2) {
   EXPECT_EQ(0u, sink.logMessages().size());
 }
 
+TEST_F(IdfFixture, Workspace_AddObjects_ResolvesNamesInBatch) {
+  // a batch of objects resolves its pointers through a name index, results must match
+  // adding the objects one at a time
+  Workspace existing(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  IdfObject existingZone(IddObjectType::Zone);
+  EXPECT_TRUE(existingZone.setName("Existing Zone"));
+  ASSERT_TRUE(existing.addObject(existingZone));
+
+  IdfObjectVector idfObjects;
+  idfObjects.push_back(IdfObject(IddObjectType::Zone));
+  EXPECT_TRUE(idfObjects.back().setName("Zone A"));
+  idfObjects.push_back(IdfObject(IddObjectType::Sizing_Zone));
+  EXPECT_TRUE(idfObjects.back().setString(Sizing_ZoneFields::ZoneorZoneListName, "zone a"));
+  idfObjects.push_back(IdfObject(IddObjectType::Sizing_Zone));
+  EXPECT_TRUE(idfObjects.back().setString(Sizing_ZoneFields::ZoneorZoneListName, "EXISTING ZONE"));
+  idfObjects.push_back(IdfObject(IddObjectType::Sizing_Zone));
+  EXPECT_TRUE(idfObjects.back().setString(Sizing_ZoneFields::ZoneorZoneListName, "Missing Zone"));
+
+  std::vector<WorkspaceObject> addedObjects = existing.addObjects(idfObjects);
+  ASSERT_EQ(4u, addedObjects.size());
+
+  OptionalWorkspaceObject target = addedObjects[1].getTarget(Sizing_ZoneFields::ZoneorZoneListName);
+  ASSERT_TRUE(target);
+  EXPECT_TRUE(target.get() == addedObjects[0]);
+
+  target = addedObjects[2].getTarget(Sizing_ZoneFields::ZoneorZoneListName);
+  ASSERT_TRUE(target);
+  EXPECT_EQ("Existing Zone", target->name().get());
+
+  EXPECT_FALSE(addedObjects[3].getTarget(Sizing_ZoneFields::ZoneorZoneListName));
+
+  // names can still be resolved after the batch
+  IdfObject sizing(IddObjectType::Sizing_Zone);
+  EXPECT_TRUE(sizing.setString(Sizing_ZoneFields::ZoneorZoneListName, "Zone A"));
+  OptionalWorkspaceObject added = existing.addObject(sizing);
+  ASSERT_TRUE(added);
+  target = added->getTarget(Sizing_ZoneFields::ZoneorZoneListName);
+  ASSERT_TRUE(target);
+  EXPECT_TRUE(target.get() == addedObjects[0]);
+}
+
+TEST_F(IdfFixture, Workspace_EditTransaction) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+
+  WorkspaceChangeCounter counter(workspace);
+  counter.watch(*zone);
+
+  // without a transaction every edit is signaled
+  EXPECT_TRUE(zone->setDouble(ZoneFields::XOrigin, 1.0));
+  EXPECT_TRUE(zone->setDouble(ZoneFields::YOrigin, 1.0));
+  EXPECT_EQ(2u, counter.numObjectChanges);
+  EXPECT_EQ(2u, counter.numObjectDataChanges);
+  EXPECT_EQ(2u, counter.numWorkspaceChanges);
+  EXPECT_EQ(0u, counter.numEditTransactionEnds);
+
+  counter.numObjectChanges = 0;
+  counter.numObjectDataChanges = 0;
+  counter.numWorkspaceChanges = 0;
+  OptionalWorkspaceObject added;
+  {
+    WorkspaceEditTransaction transaction(workspace);
+    EXPECT_TRUE(workspace.isInEditTransaction());
+    EXPECT_TRUE(zone->setDouble(ZoneFields::XOrigin, 2.0));
+    {
+      // nested transactions do not deliver signals
+      WorkspaceEditTransaction nested(workspace);
+      EXPECT_TRUE(zone->setDouble(ZoneFields::YOrigin, 2.0));
+    }
+    EXPECT_TRUE(workspace.isInEditTransaction());
+    EXPECT_TRUE(zone->setDouble(ZoneFields::ZOrigin, 2.0));
+    EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 100.0));
+    added = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(added);
+
+    // data is current, signals are held
+    EXPECT_DOUBLE_EQ(2.0, zone->getDouble(ZoneFields::YOrigin).get());
+    EXPECT_EQ(0u, counter.numObjectChanges);
+    EXPECT_EQ(0u, counter.numWorkspaceChanges);
+  }
+  EXPECT_FALSE(workspace.isInEditTransaction());
+  EXPECT_EQ(1u, counter.numObjectChanges);
+  EXPECT_EQ(1u, counter.numObjectDataChanges);
+  EXPECT_EQ(1u, counter.numWorkspaceChanges);
+  ASSERT_EQ(1u, counter.numEditTransactionEnds);
+  ASSERT_EQ(3u, counter.editTransactionHandles.size());
+  EXPECT_EQ(zone->handle(), counter.editTransactionHandles[0]);
+  EXPECT_EQ(lights->handle(), counter.editTransactionHandles[1]);
+  EXPECT_EQ(added->handle(), counter.editTransactionHandles[2]);
+
+  // a transaction without changes is silent
+  workspace.startEditTransaction();
+  workspace.endEditTransaction();
+  EXPECT_EQ(1u, counter.numWorkspaceChanges);
+  EXPECT_EQ(1u, counter.numEditTransactionEnds);
+
+  // objects removed during the transaction do not signal changes
+  counter.watch(*added);
+  workspace.startEditTransaction();
+  EXPECT_TRUE(added->setDouble(ZoneFields::XOrigin, 3.0));
+  Handle addedHandle = added->handle();
+  EXPECT_TRUE(added->remove().size() == 1u);
+  workspace.endEditTransaction();
+  EXPECT_EQ(1u, counter.numObjectChanges);
+  EXPECT_EQ(2u, counter.numWorkspaceChanges);
+  ASSERT_EQ(1u, counter.editTransactionHandles.size());
+  EXPECT_EQ(addedHandle, counter.editTransactionHandles[0]);
+}
+
 TEST_F(IdfFixture, Workspace_AddObjects3) {
   // Test added to demonstrate duplicate warning message.
 
@@ -44,6 +44,9 @@
 #include "../core/URLHelpers.hpp"
 #include "../core/Compare.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/Filesystem.hpp"
+#include "../idd/Comments.hpp"
 
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
@@ -69,7 +72,13 @@ namespace detail {
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_useNameReferenceIndex(false),
+      m_nameReferenceIndexBuilt(false),
+      m_editTransactionDepth(0),
+      m_flushingEditTransaction(false),
+      m_editTransactionChanged(false),
+      m_changeCount(0)
   {}
 
   Workspace_Impl::Workspace_Impl(const IdfFile& idfFile,
@@ -79,7 +88,13 @@ namespace detail {
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_useNameReferenceIndex(false),
+      m_nameReferenceIndexBuilt(false),
+      m_editTransactionDepth(0),
+      m_flushingEditTransaction(false),
+      m_editTransactionChanged(false),
+      m_changeCount(0)
   {}
 
   Workspace_Impl::Workspace_Impl(const Workspace_Impl& other,bool keepHandles) :
@@ -88,7 +103,13 @@ namespace detail {
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_useNameReferenceIndex(false),
+      m_nameReferenceIndexBuilt(false),
+      m_editTransactionDepth(0),
+      m_flushingEditTransaction(false),
+      m_editTransactionChanged(false),
+      m_changeCount(0)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -110,7 +131,13 @@ namespace detail {
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_useNameReferenceIndex(false),
+      m_nameReferenceIndexBuilt(false),
+      m_editTransactionDepth(0),
+      m_flushingEditTransaction(false),
+      m_editTransactionChanged(false),
+      m_changeCount(0)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -449,6 +476,25 @@ namespace detail {
       std::string name,
       const std::vector<std::string>& referenceNames) const
   {
+    if (m_useNameReferenceIndex) {
+      if (!m_nameReferenceIndexBuilt) {
+        buildNameReferenceIndex();
+      }
+      // same object as the search below, the lowest handle among all matches
+      std::string upperName = boost::to_upper_copy(name);
+      WorkspaceObject_ImplPtr result;
+      for (const std::string& referenceName : referenceNames) {
+        auto it = m_nameReferenceIndex.find(nameReferenceIndexKey(referenceName,upperName));
+        if ((it != m_nameReferenceIndex.end()) && (!result || (it->second->handle() < result->handle()))) {
+          result = it->second;
+        }
+      }
+      if (result) {
+        return WorkspaceObject(result);
+      }
+      return boost::none;
+    }
+
     for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
       OptionalString candidate = object.name();
       if (candidate && istringEqual(*candidate,name)) {
@@ -458,6 +504,36 @@ namespace detail {
     return boost::none;
   }
 
+  std::string Workspace_Impl::nameReferenceIndexKey(const std::string& referenceName,
+                                                    const std::string& upperName)
+  {
+    std::string result;
+    result.reserve(referenceName.size() + upperName.size() + 1);
+    result.append(referenceName);
+    result.push_back('\0');
+    result.append(upperName);
+    return result;
+  }
+
+  void Workspace_Impl::buildNameReferenceIndex() const {
+    m_nameReferenceIndex.clear();
+    unsigned n = 0;
+    for (const IdfReferencesMap::value_type& p : m_idfReferencesMap) {
+      n += p.second.size();
+    }
+    m_nameReferenceIndex.reserve(n);
+    for (const IdfReferencesMap::value_type& p : m_idfReferencesMap) {
+      // objects are in handle order, so the first object inserted for a key has the lowest handle
+      for (const WorkspaceObjectMap::value_type& q : p.second) {
+        OptionalString name = q.second->name();
+        if (name) {
+          m_nameReferenceIndex.insert(std::make_pair(nameReferenceIndexKey(p.first,boost::to_upper_copy(*name)),q.second));
+        }
+      }
+    }
+    m_nameReferenceIndexBuilt = true;
+  }
+
   bool Workspace_Impl::fastNaming() const
   {
     return m_fastNaming;
@@ -523,6 +599,21 @@ namespace detail {
 
     // step 2: replace string pointers
     if (ok){
+      // for more than one object, resolve names through an index built once for the batch
+      // rather than searching the reference lists for every pointer field
+      struct NameReferenceIndexGuard {
+        NameReferenceIndexGuard(Workspace_Impl& workspace, bool useIndex) : m_workspace(workspace) {
+          m_workspace.m_useNameReferenceIndex = useIndex;
+        }
+        // the index is only valid for this batch, drop it even if initializeOnAdd throws
+        ~NameReferenceIndexGuard() {
+          m_workspace.m_useNameReferenceIndex = false;
+          m_workspace.m_nameReferenceIndexBuilt = false;
+          m_workspace.m_nameReferenceIndex.clear();
+        }
+        Workspace_Impl& m_workspace;
+      } nameReferenceIndexGuard(*this, objectImplPtrs.size() > 1u);
+
       for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
         ptr->initializeOnAdd(expectToLosePointers);
         this->progressValue.nano_emit(++i);
@@ -1504,7 +1595,8 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      this->onChange.nano_emit();
+      recordEditTransactionHandle(handle);
+      this->change();
       return true;
     }
     else {
@@ -1536,7 +1628,10 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      this->onChange.nano_emit();
+      for (const SavedWorkspaceObject& savedObject : objectData) {
+        recordEditTransactionHandle(savedObject.handle);
+      }
+      this->change();
       return true;
     }
     else {
@@ -1618,6 +1713,85 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  void Workspace_Impl::startEditTransaction()
+  {
+    ++m_editTransactionDepth;
+  }
+
+  void Workspace_Impl::endEditTransaction()
+  {
+    if (m_editTransactionDepth == 0) {
+      LOG(Warn,"Ignoring call to endEditTransaction without a matching startEditTransaction.");
+      return;
+    }
+    if ((m_editTransactionDepth > 1) || m_flushingEditTransaction) {
+      --m_editTransactionDepth;
+      return;
+    }
+
+    // deliver the held object signals while still in the transaction, so that the Workspace
+    // onChange they trigger is only recorded. edits made by listeners are emitted directly.
+    m_flushingEditTransaction = true;
+    std::vector<Handle> deferredSignalHandles;
+    deferredSignalHandles.swap(m_deferredSignalHandles);
+    m_deferredSignalHandleSet.clear();
+    for (const Handle& handle : deferredSignalHandles) {
+      std::shared_ptr<WorkspaceObject_Impl> objectImplPtr = getObject(handle);
+      if (objectImplPtr) {
+        objectImplPtr->emitChangeSignals();
+      }
+    }
+    m_flushingEditTransaction = false;
+    m_editTransactionDepth = 0;
+
+    std::vector<Handle> handles;
+    handles.swap(m_editTransactionHandles);
+    m_editTransactionHandleSet.clear();
+    bool changed = m_editTransactionChanged;
+    m_editTransactionChanged = false;
+
+    if (changed) {
+      this->onChange.nano_emit();
+    }
+    if (!handles.empty()) {
+      this->onEditTransactionEnd.nano_emit(handles);
+    }
+  }
+
+  bool Workspace_Impl::isInEditTransaction() const
+  {
+    return (m_editTransactionDepth > 0);
+  }
+
+  unsigned long long Workspace_Impl::changeCount() const
+  {
+    return m_changeCount;
+  }
+
+  bool Workspace_Impl::deferChangeSignals(const Handle& handle)
+  {
+    if ((m_editTransactionDepth == 0) || m_flushingEditTransaction) {
+      return false;
+    }
+    // the workspace onChange for this edit is also held, count it now
+    ++m_changeCount;
+    if (m_deferredSignalHandleSet.insert(handle).second) {
+      m_deferredSignalHandles.push_back(handle);
+    }
+    recordEditTransactionHandle(handle);
+    return true;
+  }
+
+  void Workspace_Impl::recordEditTransactionHandle(const Handle& handle)
+  {
+    if (m_editTransactionDepth == 0) {
+      return;
+    }
+    if (m_editTransactionHandleSet.insert(handle).second) {
+      m_editTransactionHandles.push_back(handle);
+    }
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -1879,7 +2053,73 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+
+    // same extension rules as IdfFile::save
+    path wp = IdfFile::savePath(p, m_iddFileAndFactoryWrapper.iddFileType());
+
+    // do not overwrite if not allowed
+    if (!overwrite) {
+      path temp = completePathToFile(wp,path());
+      if (!temp.empty()) {
+        LOG(Info,"Save method failed because instructed not to overwrite path '"
+          << toString(wp) << "'.");
+        return false;
+      }
+    }
+
+    if (!makeParentFolder(wp)) {
+      LOG(Error,"Unable to write file to path '" << toString(wp) << "', because parent directory "
+          << "could not be created.");
+      return false;
+    }
+
+    // write next to the destination and move into place once complete, so a failed
+    // save never leaves a truncated file behind
+    path tempPath = wp.parent_path() / toPath(toString(wp.filename()) + ".tmp");
+    try {
+      openstudio::filesystem::ofstream outFile(tempPath);
+      if (!outFile) {
+        LOG(Error,"Unable to write file to path '" << toString(tempPath) << "'.");
+        return false;
+      }
+      print(outFile);
+      outFile.close();
+      if (!outFile) {
+        LOG(Error,"Unable to write file to path '" << toString(tempPath) << "'.");
+        openstudio::filesystem::remove(tempPath);
+        return false;
+      }
+      openstudio::filesystem::rename(tempPath,wp);
+    }
+    catch (...) {
+      LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
+      boost::system::error_code ec;
+      openstudio::filesystem::remove(tempPath,ec);
+      return false;
+    }
+
+    return true;
+  }
+
+  std::ostream& Workspace_Impl::print(std::ostream& os) {
+
+    std::string header = makeComment(m_header);
+    if (!header.empty()) {
+      os << header << std::endl;
+    }
+    os << std::endl;
+
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      vo->idfObject().print(os);
+    }
+
+    // objects are copied one at a time, replacing handle pointers with names
+    WorkspaceObjectVector objs = objects(true); // sorted objects
+    for (WorkspaceObject& obj : objs) {
+      obj.idfObject().print(os);
+    }
+
+    return os;
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -2343,7 +2583,8 @@ namespace detail {
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    recordEditTransactionHandle(object.handle());
+    this->change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2648,6 +2889,11 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    ++m_changeCount;
+    if (m_editTransactionDepth > 0) {
+      m_editTransactionChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
@@ -2942,6 +3188,21 @@ void Workspace::setFastNaming(bool fastNaming)
   m_impl->setFastNaming(fastNaming);
 }
 
+void Workspace::startEditTransaction()
+{
+  m_impl->startEditTransaction();
+}
+
+void Workspace::endEditTransaction()
+{
+  m_impl->endEditTransaction();
+}
+
+bool Workspace::isInEditTransaction() const
+{
+  return m_impl->isInEditTransaction();
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
@@ -3110,10 +3371,20 @@ void Workspace::addVersionObject() {
   }
 }
 
+WorkspaceEditTransaction::WorkspaceEditTransaction(const Workspace& workspace)
+  : m_workspace(workspace)
+{
+  m_workspace.startEditTransaction();
+}
+
+WorkspaceEditTransaction::~WorkspaceEditTransaction()
+{
+  m_workspace.endEditTransaction();
+}
+
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
-  os << workspace.toIdfFile();
-  return os;
+  return workspace.getImpl<detail::Workspace_Impl>()->print(os);
 }
 
 } // openstudio
@@ -341,6 +341,23 @@ class UTILITIES_API Workspace {
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  /** Start an edit transaction. Until the matching endEditTransaction, the onChange,
+   *  onNameChange, onDataChange and onRelationshipChange signals of edited objects and the
+   *  onChange signal of this Workspace are held back. Object addition and removal signals are
+   *  still emitted immediately. Transactions may be nested, only the outermost one delivers the
+   *  held signals. Prefer WorkspaceEditTransaction, which ends the transaction when it goes out
+   *  of scope. */
+  void startEditTransaction();
+
+  /** End an edit transaction started with startEditTransaction. When the outermost transaction
+   *  ends, each edited object that is still in the Workspace emits its change signals once, the
+   *  Workspace emits onChange once if anything changed, and onEditTransactionEnd is emitted
+   *  with the handles of all objects edited, added or removed during the transaction. */
+  void endEditTransaction();
+
+  /** Returns true if an edit transaction is open. */
+  bool isInEditTransaction() const;
+
   //@}
   /** @name Object Order */
   //@{
@@ -511,6 +528,31 @@ class UTILITIES_API Workspace {
 };
 
 /** \relates Workspace */
+/** WorkspaceEditTransaction starts an edit transaction on construction and ends it on
+ *  destruction, see Workspace::startEditTransaction. Bulk edits made inside the scope deliver one
+ *  set of change signals per edited object rather than one per field edit.
+ *
+ *  \code
+ *  {
+ *    WorkspaceEditTransaction transaction(workspace);
+ *    for (WorkspaceObject& object : objects) {
+ *      object.setString(1, "value");
+ *    }
+ *  } // change signals delivered here
+ *  \endcode */
+class UTILITIES_API WorkspaceEditTransaction {
+ public:
+  explicit WorkspaceEditTransaction(const Workspace& workspace);
+
+  ~WorkspaceEditTransaction();
+
+ private:
+  WorkspaceEditTransaction(const WorkspaceEditTransaction& other) = delete;
+  WorkspaceEditTransaction& operator=(const WorkspaceEditTransaction& other) = delete;
+
+  Workspace m_workspace;
+};
+
 typedef boost::optional<Workspace> OptionalWorkspace;
 
 /** \relates Workspace */
@@ -227,6 +227,26 @@ namespace detail {
     return IdfObject_Impl::getString(index,returnDefault,returnUninitializedEmpty);
   }
 
+  std::shared_ptr<WorkspaceObject_Impl> WorkspaceObject_Impl::resolvePointer(
+      const Handle& handle,
+      std::weak_ptr<WorkspaceObject_Impl>& cache) const
+  {
+    // the cached object is only trusted if it still carries handle and lives in the same
+    // workspace; removal nulls the handle, and clones copy the cache across workspaces
+    std::shared_ptr<WorkspaceObject_Impl> result = cache.lock();
+    if (result && (result->m_workspace == m_workspace) && (result->m_handle == handle)) {
+      return result;
+    }
+
+    result.reset();
+    OptionalWorkspaceObject owo = m_workspace->getObject(handle);
+    if (owo) {
+      result = owo->getImpl<WorkspaceObject_Impl>();
+    }
+    cache = result;
+    return result;
+  }
+
   OptionalWorkspaceObject WorkspaceObject_Impl::getTarget(unsigned index) const {
     if (!initialized()) { return boost::none; }
 
@@ -236,7 +256,10 @@ namespace detail {
       if (fpIt != m_sourceData->pointers.end()) {
         Handle th = fpIt->targetHandle;
         if (!th.isNull()) {
-          return this->workspace().getObject(th);
+          std::shared_ptr<WorkspaceObject_Impl> target = resolvePointer(th,fpIt->target);
+          if (target) {
+            return WorkspaceObject(target);
+          }
         }
       }
     }
@@ -248,11 +271,12 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_sourceData) {
+      result.reserve(m_sourceData->pointers.size());
       for (const ForwardPointer& ptr : m_sourceData->pointers) {
         if (!ptr.targetHandle.isNull()) {
-          OptionalWorkspaceObject owo = this->workspace().getObject(ptr.targetHandle);
-          OS_ASSERT(owo);
-          result.push_back(*owo);
+          std::shared_ptr<WorkspaceObject_Impl> target = resolvePointer(ptr.targetHandle,ptr.target);
+          OS_ASSERT(target);
+          result.push_back(WorkspaceObject(target));
         }
       }
     }
@@ -275,14 +299,17 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
+      // reversePointers is ordered by sourceHandle, so repeated sources are adjacent
+      const Handle* lastHandle = nullptr;
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+        if (lastHandle && (*lastHandle == ptr.sourceHandle)) { continue; }
+        lastHandle = &ptr.sourceHandle;
+        std::shared_ptr<WorkspaceObject_Impl> source = resolvePointer(ptr.sourceHandle,ptr.source);
+        OS_ASSERT(source);
+        result.push_back(WorkspaceObject(source));
       }
       std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -291,14 +318,16 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
+      const Handle* lastHandle = nullptr;
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+        if (lastHandle && (*lastHandle == ptr.sourceHandle)) { continue; }
+        lastHandle = &ptr.sourceHandle;
+        std::shared_ptr<WorkspaceObject_Impl> source = resolvePointer(ptr.sourceHandle,ptr.source);
+        OS_ASSERT(source);
+        if (source->iddObject().type() == type) { result.push_back(WorkspaceObject(source)); }
       }
       std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -916,6 +945,11 @@ namespace detail {
       return;
     }
 
+    // diffs accumulate until the Workspace edit transaction ends
+    if (m_workspace && !m_handle.isNull() && m_workspace->deferChangeSignals(m_handle)){
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -44,11 +44,16 @@ class Workspace;
 namespace detail {
 
   class Workspace_Impl; // forward declaration
+  class WorkspaceObject_Impl; // forward declaration
 
   struct UTILITIES_API ForwardPointer {
     unsigned fieldIndex;
     Handle   targetHandle;
 
+    /** Direct pointer to the target, filled in on first resolution and validated against
+     *  targetHandle on every use. Never relied upon without that check. */
+    mutable std::weak_ptr<WorkspaceObject_Impl> target;
+
     /// \todo Default constructor needed to iterate over Source Map, but setting fieldIndex to 0
     /// seems sub-optimal.
     ForwardPointer() : fieldIndex(0) {}
@@ -70,6 +75,10 @@ namespace detail {
     Handle   sourceHandle;
     unsigned fieldIndex;
 
+    /** Direct pointer to the source, filled in on first resolution and validated against
+     *  sourceHandle on every use. Never relied upon without that check. */
+    mutable std::weak_ptr<WorkspaceObject_Impl> source;
+
     ReversePointer() : fieldIndex(0) {}
     ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i) {}
   };
@@ -339,6 +348,11 @@ namespace detail {
 
    private:
 
+    /** Returns the object with handle in this object's workspace. Uses cache if it still points
+     *  to that object, otherwise looks handle up in the workspace and refreshes cache. */
+    std::shared_ptr<WorkspaceObject_Impl> resolvePointer(const Handle& handle,
+                                                         std::weak_ptr<WorkspaceObject_Impl>& cache) const;
+
     bool                m_initialized;
     Workspace_Impl*     m_workspace;
     OptionalSourceData  m_sourceData;
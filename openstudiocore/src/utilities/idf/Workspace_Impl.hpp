@@ -46,6 +46,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -350,6 +351,21 @@ namespace detail {
      */
     void setFastNaming(bool fastNaming);
 
+    void startEditTransaction();
+
+    void endEditTransaction();
+
+    bool isInEditTransaction() const;
+
+    /** Returns the number of changes made to this workspace and its objects so far, including
+     *  changes whose signals are held by an edit transaction. Derived data cached alongside the
+     *  value returned here is current as long as changeCount is unchanged. */
+    unsigned long long changeCount() const;
+
+    /** Called by WorkspaceObject_Impl::emitChangeSignals. Returns true if the change signals of
+     *  the object with handle should be held until the current edit transaction ends. */
+    bool deferChangeSignals(const Handle& handle);
+
     /** Resolve name conflicts within other, and between this workspace and other by renaming objects
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
@@ -429,6 +445,10 @@ namespace detail {
      *  .idf or modelFileExtension() depending on the underlying IddFileType. */
     virtual bool save(const openstudio::path& p, bool overwrite=false);
 
+    /** Prints the same text as toIdfFile().print(os), but serializes one object at a time rather
+     *  than copying the whole Workspace into an IdfFile first. Names objects if necessary. */
+    std::ostream& print(std::ostream& os);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
@@ -475,6 +495,11 @@ namespace detail {
     // DLM: deprecate this version
     // void addWorkspaceObjectPtr(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
     mutable Nano::Signal<void(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)> addWorkspaceObjectPtr;
+
+    /** Sent when the outermost edit transaction ends, after the held change signals, with the
+     *  handles of all objects edited, added or removed during the transaction. */
+    // void onEditTransactionEnd(const std::vector<openstudio::Handle>& handles) const;
+    mutable Nano::Signal<void(const std::vector<openstudio::Handle>&)> onEditTransactionEnd;
     //@}
 
 
@@ -518,6 +543,32 @@ namespace detail {
     typedef std::map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // index of reference name and upper case object name to the object with the lowest handle,
+    // which is what getObjectByNameAndReference would find. only used while addObjects resolves
+    // the pointers of a batch of objects, during which no names change. built on first use.
+    typedef std::unordered_map<std::string, std::shared_ptr<WorkspaceObject_Impl> > NameReferenceIndex;
+    bool m_useNameReferenceIndex;
+    mutable NameReferenceIndex m_nameReferenceIndex;
+    mutable bool m_nameReferenceIndexBuilt;
+
+    static std::string nameReferenceIndexKey(const std::string& referenceName, const std::string& upperName);
+
+    void buildNameReferenceIndex() const;
+
+    // edit transaction state. objects whose change signals are held are listed in
+    // m_deferredSignalHandles, every object touched in m_editTransactionHandles.
+    unsigned m_editTransactionDepth;
+    bool m_flushingEditTransaction;
+    bool m_editTransactionChanged;
+    std::vector<Handle> m_deferredSignalHandles;
+    HandleSet m_deferredSignalHandleSet;
+    std::vector<Handle> m_editTransactionHandles;
+    HandleSet m_editTransactionHandleSet;
+
+    unsigned long long m_changeCount;
+
+    void recordEditTransactionHandle(const Handle& handle);
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
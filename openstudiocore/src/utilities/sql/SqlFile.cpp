@@ -35,10 +35,10 @@ namespace openstudio{
 SqlFile::SqlFile()
 {}
 
-SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes)
+SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly)
 {
   try{
-    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes));
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes, readOnly));
   }catch(const std::exception& e){
     LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
   }
@@ -81,6 +81,15 @@ bool SqlFile::connectionOpen() const
   return result;
 }
 
+bool SqlFile::isReadOnly() const
+{
+  bool result = false;
+  if (m_impl){
+    result = m_impl->isReadOnly();
+  }
+  return result;
+}
+
 openstudio::path SqlFile::path() const {
   openstudio::path result;
   if (m_impl) {
@@ -1298,6 +1307,91 @@ boost::optional<double> SqlFile::runPeriodValue(const std::string& envPeriod, co
   return result;
 }
 
+boost::optional<double> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName,
+    const std::string& columnName, const std::string& units) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName,
+    const std::string& columnName) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName);
+  }
+  return result;
+}
+
+boost::optional<std::string> SqlFile::tabularDataString(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName,
+    const std::string& columnName, const std::string& units) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataString(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<std::string> SqlFile::tabularDataString(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName,
+    const std::string& columnName) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataString(reportName, reportForString, tableName, rowName, columnName);
+  }
+  return result;
+}
+
+boost::optional<std::string> SqlFile::tabularDataRowName(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const boost::optional<std::string>& columnName,
+    const std::string& value) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataRowName(reportName, reportForString, tableName, columnName, value);
+  }
+  return result;
+}
+
+std::vector<std::string> SqlFile::tabularDataRowNames(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName) const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataRowNames(reportName, reportForString, tableName);
+  }
+  return result;
+}
+
+std::vector<std::string> SqlFile::tabularDataColumnNames(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName) const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataColumnNames(reportName, reportForString, tableName);
+  }
+  return result;
+}
+
+std::vector<std::vector<std::string> > SqlFile::tabularDataTable(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName) const
+{
+  std::vector<std::vector<std::string> > result;
+  if (m_impl){
+    result = m_impl->tabularDataTable(reportName, reportForString, tableName);
+  }
+  return result;
+}
+
 boost::optional<double> SqlFile::execAndReturnFirstDouble(const std::string& statement) const
 {
   boost::optional<double> result;
@@ -1387,6 +1481,14 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+bool SqlFile::exportTimeSeries(const openstudio::path& path) {
+  bool result = false;
+  if (m_impl) {
+    result = m_impl->exportTimeSeries(path);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime> > SqlFile::daylightSavingsPeriod() const
 {
   boost::optional<std::pair<DateTime, DateTime> > result;
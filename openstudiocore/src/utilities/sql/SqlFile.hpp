@@ -79,7 +79,9 @@ class UTILITIES_API SqlFile {
 
   /// constructor from path
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
-  explicit SqlFile(const openstudio::path& path, const bool createIndexes=true);
+  /// Pass in true for readOnly to open the file without write access, the file is then never modified
+  /// (no indexes are created) and any number of readers may open the same file concurrently
+  explicit SqlFile(const openstudio::path& path, const bool createIndexes=true, const bool readOnly=false);
 
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
@@ -102,6 +104,9 @@ class UTILITIES_API SqlFile {
   /// returns whether or not connection is open
   bool connectionOpen() const;
 
+  /// returns whether or not the file was opened read only
+  bool isReadOnly() const;
+
   /// get the path
   openstudio::path path() const;
 
@@ -703,6 +708,11 @@ class UTILITIES_API SqlFile {
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Writes every time series in the file to a TimeSeriesStore at path, returns false if the store
+   *  cannot be written. Repeated reads of the time series can then be served from the store without
+   *  querying the sql file. */
+  bool exportTimeSeries(const openstudio::path& path);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -810,6 +820,52 @@ class UTILITIES_API SqlFile {
       const std::vector<DateTime> &t_times,
       const std::vector<double> &t_xs, const std::vector<double> &t_ys, double t_z, const std::vector<Matrix> &t_maps);
 
+  //@}
+  /** @name Tabular Report Interface
+   *
+   *  Tabular report values are loaded from the TabularData table into an in-memory index on first
+   *  use, each lookup is then a hash lookup rather than a query of the TabularDataWithStrings view.
+   *  Names must match exactly, as in an SQL query of that view. */
+  //@{
+
+  /// value of the tabular report cell as a double
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                           const std::string& tableName, const std::string& rowName,
+                                           const std::string& columnName, const std::string& units) const;
+
+  /// value of the tabular report cell as a double, in any units
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                           const std::string& tableName, const std::string& rowName,
+                                           const std::string& columnName) const;
+
+  /// value of the tabular report cell as a string
+  boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                 const std::string& tableName, const std::string& rowName,
+                                                 const std::string& columnName, const std::string& units) const;
+
+  /// value of the tabular report cell as a string, in any units
+  boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                 const std::string& tableName, const std::string& rowName,
+                                                 const std::string& columnName) const;
+
+  /// name of the first row of the table that has value in columnName, or in any column if columnName is empty
+  boost::optional<std::string> tabularDataRowName(const std::string& reportName, const std::string& reportForString,
+                                                  const std::string& tableName, const boost::optional<std::string>& columnName,
+                                                  const std::string& value) const;
+
+  /// names of the rows of the table, in report order
+  std::vector<std::string> tabularDataRowNames(const std::string& reportName, const std::string& reportForString,
+                                               const std::string& tableName) const;
+
+  /// names of the columns of the table, in report order
+  std::vector<std::string> tabularDataColumnNames(const std::string& reportName, const std::string& reportForString,
+                                                  const std::string& tableName) const;
+
+  /** all values of the table, result[i][j] is the value in row tabularDataRowNames()[i] and column
+   *  tabularDataColumnNames()[j], empty if the table has no such cell */
+  std::vector<std::vector<std::string> > tabularDataTable(const std::string& reportName, const std::string& reportForString,
+                                                          const std::string& tableName) const;
+
   //@}
   /** @name Generic Query Interface */
   //@{
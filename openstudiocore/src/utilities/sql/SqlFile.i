@@ -8,6 +8,8 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/TimeSeriesStore.hpp>
+  #include <utilities/sql/SqlFileCollection.hpp>
   
   #include <utilities/units/Unit.hpp>
   #include <utilities/units/BTUUnit.hpp>
@@ -26,6 +28,9 @@
 // ignore detail namespace
 %ignore openstudio::detail;
 
+// std::function metrics cannot be passed from the bindings, use the predefined queries instead
+%ignore openstudio::SqlFileCollection::evaluate;
+
 // These functions return via reference parameters - something we cannot support with SWIG
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string &, double &, double &);
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double &, double &);
@@ -43,9 +48,12 @@
 %template(IntDateTimePairVector) std::vector<std::pair<int, openstudio::DateTime> >;
 
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
+%template(OptionalTimeSeriesStore) boost::optional<openstudio::TimeSeriesStore>;
 
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
+%include <utilities/sql/TimeSeriesStore.hpp>
+%include <utilities/sql/SqlFileCollection.hpp>
 
 #endif //UTILITIES_OUTPUT_SQLFILE_I 
@@ -0,0 +1,219 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "SqlFileCollection.hpp"
+#include "SqlFile.hpp"
+
+#include "../data/EndUses.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../core/System.hpp"
+
+#include <boost/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace openstudio {
+
+namespace {
+
+  const double notAvailable = std::numeric_limits<double>::quiet_NaN();
+
+}
+
+SqlFileCollection::SqlFileCollection(const std::vector<openstudio::path>& paths, unsigned numThreads)
+  : m_paths(paths), m_numThreads(numThreads)
+{
+}
+
+std::vector<openstudio::path> SqlFileCollection::paths() const
+{
+  return m_paths;
+}
+
+unsigned SqlFileCollection::numThreads() const
+{
+  if (m_numThreads == 0){
+    return System::numberOfProcessors();
+  }
+  return m_numThreads;
+}
+
+void SqlFileCollection::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+Matrix SqlFileCollection::evaluateRows(const RowFunction& rowFunction, unsigned numColumns) const
+{
+  const size_t numFiles = m_paths.size();
+  std::vector<std::vector<double> > rows(numFiles);
+
+  auto evaluateFile = [&](size_t i) {
+    SqlFile sqlFile(m_paths[i], false, true);
+    if (!sqlFile.connectionOpen()){
+      LOG(Warn, "Could not open '" << toString(m_paths[i]) << "'");
+      return;
+    }
+    try {
+      rows[i] = rowFunction(sqlFile);
+    } catch (const std::exception& e) {
+      LOG(Warn, "Could not evaluate '" << toString(m_paths[i]) << "': " << e.what());
+    }
+    sqlFile.close();
+  };
+
+  // each worker takes the next file until all are done, rows are only written by the worker that took the file
+  std::atomic<size_t> nextFile(0);
+  auto worker = [&]() {
+    for (size_t i = nextFile++; i < numFiles; i = nextFile++){
+      evaluateFile(i);
+    }
+  };
+
+  // the first file is evaluated before starting the other workers so that static data used by SqlFile is
+  // initialized on this thread
+  if (numFiles > 0){
+    evaluateFile(nextFile++);
+  }
+
+  size_t numWorkers = std::min<size_t>(numThreads(), numFiles);
+  boost::thread_group threads;
+  for (size_t i = 1; i < numWorkers; ++i){
+    threads.create_thread(worker);
+  }
+  worker();
+  threads.join_all();
+
+  if (numColumns == 0){
+    for (const std::vector<double>& row : rows){
+      numColumns = std::max<unsigned>(numColumns, row.size());
+    }
+  }
+
+  Matrix result(numFiles, numColumns);
+  for (size_t i = 0; i < numFiles; ++i){
+    for (size_t j = 0; j < numColumns; ++j){
+      result(i, j) = (j < rows[i].size()) ? rows[i][j] : notAvailable;
+    }
+  }
+
+  return result;
+}
+
+Matrix SqlFileCollection::evaluate(const std::vector<Metric>& metrics) const
+{
+  return evaluateRows([&metrics](SqlFile& sqlFile) {
+    std::vector<double> row;
+    row.reserve(metrics.size());
+    for (const Metric& metric : metrics){
+      boost::optional<double> value = metric(sqlFile);
+      row.push_back(value ? *value : notAvailable);
+    }
+    return row;
+  }, metrics.size());
+}
+
+Matrix SqlFileCollection::summaryValues() const
+{
+  std::vector<Metric> metrics;
+  metrics.push_back([](SqlFile& sqlFile) { return sqlFile.netSiteEnergy(); });
+  metrics.push_back([](SqlFile& sqlFile) { return sqlFile.totalSiteEnergy(); });
+  metrics.push_back([](SqlFile& sqlFile) { return sqlFile.netSourceEnergy(); });
+  metrics.push_back([](SqlFile& sqlFile) { return sqlFile.totalSourceEnergy(); });
+  metrics.push_back([](SqlFile& sqlFile) { return sqlFile.hoursSimulated(); });
+  return evaluate(metrics);
+}
+
+std::vector<std::string> SqlFileCollection::summaryValueNames()
+{
+  std::vector<std::string> result;
+  result.push_back("netSiteEnergy");
+  result.push_back("totalSiteEnergy");
+  result.push_back("netSourceEnergy");
+  result.push_back("totalSourceEnergy");
+  result.push_back("hoursSimulated");
+  return result;
+}
+
+Matrix SqlFileCollection::endUseValues() const
+{
+  std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+  std::vector<EndUseCategoryType> categories = EndUses::categories();
+  unsigned numColumns = fuelTypes.size() * categories.size();
+
+  return evaluateRows([&fuelTypes, &categories](SqlFile& sqlFile) {
+    std::vector<double> row;
+    boost::optional<EndUses> endUses = sqlFile.endUses();
+    if (endUses){
+      for (const EndUseFuelType& fuelType : fuelTypes){
+        for (const EndUseCategoryType& category : categories){
+          row.push_back(endUses->getEndUse(fuelType, category));
+        }
+      }
+    }
+    return row;
+  }, numColumns);
+}
+
+std::vector<std::string> SqlFileCollection::endUseValueNames()
+{
+  std::vector<std::string> result;
+  for (const EndUseFuelType& fuelType : EndUses::fuelTypes()){
+    for (const EndUseCategoryType& category : EndUses::categories()){
+      result.push_back(fuelType.valueName() + ":" + category.valueName());
+    }
+  }
+  return result;
+}
+
+Matrix SqlFileCollection::timeSeriesValues(const std::string& envPeriod,
+                                           const std::string& reportingFrequency,
+                                           const std::string& timeSeriesName,
+                                           const std::string& keyValue) const
+{
+  return evaluateRows([&](SqlFile& sqlFile) {
+    std::vector<double> row;
+    std::string fileEnvPeriod = envPeriod;
+    if (fileEnvPeriod.empty()){
+      std::vector<std::string> envPeriods = sqlFile.availableEnvPeriods();
+      if (envPeriods.empty()){
+        return row;
+      }
+      fileEnvPeriod = envPeriods[0];
+    }
+    boost::optional<TimeSeries> timeSeries = sqlFile.timeSeries(fileEnvPeriod, reportingFrequency, timeSeriesName, keyValue);
+    if (timeSeries){
+      row = toStandardVector(timeSeries->values());
+    }
+    return row;
+  }, 0);
+}
+
+} // openstudio
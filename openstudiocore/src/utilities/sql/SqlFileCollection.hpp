@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILECOLLECTION_HPP
+#define UTILITIES_SQL_SQLFILECOLLECTION_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../data/Matrix.hpp"
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class SqlFile;
+
+/** SqlFileCollection evaluates the same queries on the sql files of many simulations, e.g. the runs
+ *  of a parametric study, and returns the results as a matrix with one row per file. Files are
+ *  opened read only by a pool of worker threads, each file is closed as soon as its row is complete,
+ *  so at most one file per thread is open at once. Result values that are not available, including
+ *  all values of files that cannot be opened, are NaN. */
+class UTILITIES_API SqlFileCollection {
+ public:
+
+  /// computes one value from a sql file, returns boost::none if the value is not available
+  typedef std::function<boost::optional<double> (SqlFile&)> Metric;
+
+  /// constructor from paths of sql files, numThreads of zero uses one thread per processor
+  explicit SqlFileCollection(const std::vector<openstudio::path>& paths, unsigned numThreads = 0);
+
+  /// get the paths, in row order
+  std::vector<openstudio::path> paths() const;
+
+  /// number of worker threads
+  unsigned numThreads() const;
+
+  /// set the number of worker threads, zero uses one thread per processor
+  void setNumThreads(unsigned numThreads);
+
+  /// result(i, j) is metrics[j] evaluated on paths()[i]
+  Matrix evaluate(const std::vector<Metric>& metrics) const;
+
+  /// columns are netSiteEnergy, totalSiteEnergy, netSourceEnergy, totalSourceEnergy and hoursSimulated
+  Matrix summaryValues() const;
+
+  /// names of the summaryValues columns
+  static std::vector<std::string> summaryValueNames();
+
+  /// columns are EndUses::getEndUse for every pair of EndUses::fuelTypes() and EndUses::categories(),
+  /// ordered by fuel type and then by category
+  Matrix endUseValues() const;
+
+  /// names of the endUseValues columns, e.g. "Electricity:Heating"
+  static std::vector<std::string> endUseValueNames();
+
+  /// row i is the values of the time series in paths()[i], rows shorter than the longest series are padded with NaN
+  /// if envPeriod is empty the first environment period of each file is used
+  Matrix timeSeriesValues(const std::string& envPeriod,
+                          const std::string& reportingFrequency,
+                          const std::string& timeSeriesName,
+                          const std::string& keyValue) const;
+
+ private:
+
+  // computes one row from a sql file, values that are not available are NaN
+  typedef std::function<std::vector<double> (SqlFile&)> RowFunction;
+
+  // evaluates rowFunction on every file, numColumns of zero uses the length of the longest row
+  Matrix evaluateRows(const RowFunction& rowFunction, unsigned numColumns) const;
+
+  std::vector<openstudio::path> m_paths;
+  unsigned m_numThreads;
+
+  REGISTER_LOGGER("openstudio.SqlFileCollection");
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_SQLFILECOLLECTION_HPP
@@ -28,6 +28,7 @@
 
 #include "SqlFile_Impl.hpp"
 #include "SqlFileTimeSeriesQuery.hpp"
+#include "TimeSeriesStore.hpp"
 #include "OpenStudio.hxx"
 
 #include "../core/String.hpp"
@@ -42,6 +43,9 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include <limits>
+#include <set>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -59,19 +63,20 @@ namespace openstudio{
       return std::string(reinterpret_cast<const char*>(column));
     }
 
-    SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false)
+    SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
+      : m_tabularDataLoaded(false), m_path(path), m_connectionOpen(false), m_readOnly(readOnly), m_supportedVersion(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
       }
       reopen();
-      if (createIndexes) this->createIndexes();
+      // a read only file is queried as is, without adding indexes
+      if (createIndexes && !m_readOnly) this->createIndexes();
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_tabularDataLoaded(false), m_path(t_path), m_readOnly(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -149,6 +154,12 @@ namespace openstudio{
 
     void SqlFile_Impl::removeIndexes()
     {
+      if (m_readOnly)
+      {
+        LOG(Warn, "Cannot remove indexes from read only file '" << toString(m_path) << "'");
+        return;
+      }
+
       if (m_connectionOpen)
       {
         try {
@@ -191,6 +202,12 @@ namespace openstudio{
 
     void SqlFile_Impl::createIndexes()
     {
+      if (m_readOnly)
+      {
+        LOG(Warn, "Cannot add indexes to read only file '" << toString(m_path) << "'");
+        return;
+      }
+
       if (m_connectionOpen)
       {
         try {
@@ -392,6 +409,11 @@ namespace openstudio{
       return m_connectionOpen;
     }
 
+    bool SqlFile_Impl::isReadOnly() const
+    {
+      return m_readOnly;
+    }
+
     int SqlFile_Impl::getNextIndex(const std::string &t_tableName, const std::string &t_columnName)
     {
       boost::optional<int> maxindex = execAndReturnFirstInt("select max(" + t_columnName + ") from " + t_tableName);
@@ -416,6 +438,7 @@ namespace openstudio{
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
+      clearTabularData();
       return true;
     }
 
@@ -438,7 +461,14 @@ namespace openstudio{
       m_sqliteFilename = toString(m_path.make_preferred().native());
       std::string fileName = m_sqliteFilename;
 
-      int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+      // a read only connection only takes shared locks, so any number of readers can open the same file at once,
+      // including on a read only file system, full mutex allows this connection to be shared between threads
+      int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE;
+      if (m_readOnly) {
+        flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX;
+      }
+
+      int code = sqlite3_open_v2(fileName.c_str(), &m_db, flags, nullptr);
 
       m_connectionOpen = (code == 0);
       if (m_connectionOpen) {// create index on dictionaryIndex for large table reportvariabledata
@@ -874,14 +904,11 @@ namespace openstudio{
         boost::algorithm::to_upper_copy(t_fuelType.valueName());
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='J'";
-
-      return execAndReturnFirstDouble(s);
+      const TabularDataCell* cell = tabularDataCell(reportname, "Meter", boost::none, rowname, columnname, std::string("J"));
+      if (cell){
+        return cell->doubleValue;
+      }
+      return boost::none;
     }
     
     //TODO
@@ -896,28 +923,19 @@ namespace openstudio{
         " {AT MAX/MIN}";
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='W'";
-
-      return execAndReturnFirstDouble(s);
+      const TabularDataCell* cell = tabularDataCell(reportname, "Meter", boost::none, rowname, columnname, std::string("W"));
+      if (cell){
+        return cell->doubleValue;
+      }
+      return boost::none;
     }
 
     /// hours simulated
     boost::optional<double> SqlFile_Impl::hoursSimulated() const
     {
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='InputVerificationandResultsSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='General' AND \
-                              RowName='Hours Simulated' AND \
-                              Units='hrs'";
-      boost::optional<double> ret = execAndReturnFirstDouble(s);
-
-      if (ret) return ret;
+      const TabularDataCell* cell = tabularDataCell("InputVerificationandResultsSummary", "Entire Facility",
+                                                    std::string("General"), std::string("Hours Simulated"), boost::none, std::string("hrs"));
+      if (cell) return cell->doubleValue;
 
       // Otherwise, let's try to calculate it:
       return execAndReturnFirstDouble(
@@ -938,14 +956,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -969,14 +980,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -989,14 +993,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -1009,24 +1006,17 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCost("Electric");
       }
       else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCost("Gas");
       }
       else { 
         // E+ lumps all other fuel types under "Other," so we are forced to use the meters table instead.  
@@ -1064,9 +1054,9 @@ namespace openstudio{
           meterName = "ENERGYTRANSFER:FACILITY";
         }
 
-        auto rowName = execAndReturnFirstString("SELECT RowName FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value='" + meterName + "'");
+        auto rowName = tabularDataRowName("Economics Results Summary Report", "Entire Facility", "Tariff Summary", boost::none, meterName);
         if (rowName){
-          return execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName='" + rowName.get() + "' AND ColumnName='Annual Cost (~~$~~)'");
+          return tabularDataValue("Economics Results Summary Report", "Entire Facility", "Tariff Summary", rowName.get(), "Annual Cost (~~$~~)");
         }
         else {
           return boost::none; // Return an empty optional double, indicating that there is no annual cost for this energy type
@@ -1080,7 +1070,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Total Building Area", "Area", "m2");
       
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1098,7 +1088,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Net Conditioned Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1274,10 +1264,7 @@ namespace openstudio{
       }
       if(name.size() == 0) return result;
 
-      query = "SELECT value from tabulardatawithstrings where ReportName = 'Tariff Report' and ReportForString = '";
-      query += name;
-      query +=  "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-      result = execAndReturnFirstDouble(query);
+      result = tabularDataValue("Tariff Report", name, "Native Variables", "TotalEnergy", "Sum");
 
       return result;
     }
@@ -1307,10 +1294,8 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+                                                           category.valueDescription(), fuelType.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1326,464 +1311,464 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Heating') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Heating", "hr");
     }
 
     OptionalDouble SqlFile_Impl::hoursCoolingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Cooling') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Cooling", "hr");
     }
 
 
@@ -2060,9 +2045,355 @@ namespace openstudio{
         // must finalize to prevent memory leaks
         sqlite3_finalize(sqlStmtPtr);
       }
+      // the statement may have changed the tabular data
+      clearTabularData();
       return code;
     }
 
+    namespace {
+
+      // string id that matches any string in a TabularDataKey
+      const unsigned anyTabularDataString = std::numeric_limits<unsigned>::max();
+
+      // string id of a NULL string, never matches
+      const unsigned nullTabularDataString = std::numeric_limits<unsigned>::max() - 1;
+
+    }
+
+    bool SqlFile_Impl::TabularDataKey::operator==(const TabularDataKey& other) const
+    {
+      return ((reportName == other.reportName) &&
+              (reportForString == other.reportForString) &&
+              (tableName == other.tableName) &&
+              (rowName == other.rowName) &&
+              (columnName == other.columnName) &&
+              (units == other.units));
+    }
+
+    size_t SqlFile_Impl::TabularDataKeyHash::operator()(const TabularDataKey& key) const
+    {
+      size_t result = key.reportName;
+      for (unsigned id : {key.reportForString, key.tableName, key.rowName, key.columnName, key.units}){
+        result = result * 1000003u + id;
+      }
+      return result;
+    }
+
+    unsigned SqlFile_Impl::internTabularDataString(const std::string& str) const
+    {
+      auto it = m_tabularDataStringIds.find(str);
+      if (it != m_tabularDataStringIds.end()){
+        return it->second;
+      }
+      unsigned id = m_tabularDataStrings.size();
+      m_tabularDataStrings.push_back(str);
+      m_tabularDataStringIds.insert(std::make_pair(str, id));
+      return id;
+    }
+
+    boost::optional<unsigned> SqlFile_Impl::tabularDataStringId(const std::string& str) const
+    {
+      auto it = m_tabularDataStringIds.find(str);
+      if (it != m_tabularDataStringIds.end()){
+        return it->second;
+      }
+      return boost::none;
+    }
+
+    void SqlFile_Impl::clearTabularData()
+    {
+      std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+      m_tabularDataLoaded = false;
+      m_tabularDataStrings.clear();
+      m_tabularDataStringIds.clear();
+      m_tabularDataCells.clear();
+      m_tabularDataCellIndex.clear();
+      m_tabularDataValueIndex.clear();
+      m_tabularDataTables.clear();
+      m_tabularDataReports.clear();
+    }
+
+    void SqlFile_Impl::loadTabularData() const
+    {
+      std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+      if (m_tabularDataLoaded){
+        return;
+      }
+      m_tabularDataLoaded = true;
+
+      if (!m_db){
+        return;
+      }
+
+      // Strings holds the report, table, row, column and units names referenced by TabularData
+      std::unordered_map<int, unsigned> stringIds;
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      int code = sqlite3_prepare_v2(m_db, "SELECT StringIndex, Value FROM Strings", -1, &sqlStmtPtr, nullptr);
+      if (code == SQLITE_OK){
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW){
+          const unsigned char* text = sqlite3_column_text(sqlStmtPtr, 1);
+          stringIds[sqlite3_column_int(sqlStmtPtr, 0)] = (text ? internTabularDataString(columnText(text)) : nullTabularDataString);
+        }
+      }
+      sqlite3_finalize(sqlStmtPtr);
+
+      if (stringIds.empty()){
+        return;
+      }
+
+      sqlStmtPtr = nullptr;
+      code = sqlite3_prepare_v2(m_db, "SELECT ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, ColumnNameIndex, UnitsIndex, Value FROM TabularData ORDER BY TabularDataIndex", -1, &sqlStmtPtr, nullptr);
+      if (code == SQLITE_OK){
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW){
+
+          // as in the TabularDataWithStrings view, rows with dangling string indices are skipped.
+          // rows with NULL names are skipped as well, no query can match them.
+          unsigned ids[6];
+          bool found = true;
+          for (int i = 0; i < 6; ++i){
+            auto it = stringIds.find(sqlite3_column_int(sqlStmtPtr, i));
+            if ((it == stringIds.end()) || (it->second == nullTabularDataString)){
+              found = false;
+              break;
+            }
+            ids[i] = it->second;
+          }
+          if (!found){
+            continue;
+          }
+
+          TabularDataCell cell;
+          cell.key = TabularDataKey{ids[0], ids[1], ids[2], ids[3], ids[4], ids[5]};
+          const unsigned char* text = sqlite3_column_text(sqlStmtPtr, 6);
+          cell.value = (text ? internTabularDataString(columnText(text)) : nullTabularDataString);
+          cell.doubleValue = sqlite3_column_double(sqlStmtPtr, 6);
+
+          size_t index = m_tabularDataCells.size();
+          m_tabularDataCells.push_back(cell);
+
+          // emplace keeps the first cell for each key
+          TabularDataKey key = cell.key;
+          m_tabularDataCellIndex.emplace(key, index);
+          key.units = anyTabularDataString;
+          m_tabularDataCellIndex.emplace(key, index);
+
+          key.rowName = cell.value;
+          m_tabularDataValueIndex.emplace(key, index);
+          key.columnName = anyTabularDataString;
+          m_tabularDataValueIndex.emplace(key, index);
+
+          key = TabularDataKey{ids[0], ids[1], ids[2], anyTabularDataString, anyTabularDataString, anyTabularDataString};
+          m_tabularDataTables[key].push_back(index);
+          key.tableName = anyTabularDataString;
+          m_tabularDataReports[key].push_back(index);
+        }
+      }
+      sqlite3_finalize(sqlStmtPtr);
+
+      LOG(Debug, "Loaded " << m_tabularDataCells.size() << " tabular data values");
+    }
+
+    const SqlFile_Impl::TabularDataCell* SqlFile_Impl::tabularDataCell(const std::string& reportName, const std::string& reportForString,
+                                                                       const boost::optional<std::string>& tableName, const boost::optional<std::string>& rowName,
+                                                                       const boost::optional<std::string>& columnName, const boost::optional<std::string>& units) const
+    {
+      loadTabularData();
+
+      // names that do not appear in the data cannot match
+      TabularDataKey key{anyTabularDataString, anyTabularDataString, anyTabularDataString, anyTabularDataString, anyTabularDataString, anyTabularDataString};
+      unsigned* ids[6] = {&key.reportName, &key.reportForString, &key.tableName, &key.rowName, &key.columnName, &key.units};
+      const boost::optional<std::string> names[6] = {reportName, reportForString, tableName, rowName, columnName, units};
+      for (int i = 0; i < 6; ++i){
+        if (names[i]){
+          boost::optional<unsigned> id = tabularDataStringId(*names[i]);
+          if (!id){
+            return nullptr;
+          }
+          *ids[i] = *id;
+        }
+      }
+
+      if (tableName && rowName && columnName){
+        auto it = m_tabularDataCellIndex.find(key);
+        if (it != m_tabularDataCellIndex.end()){
+          return &m_tabularDataCells[it->second];
+        }
+        return nullptr;
+      }
+
+      // partial keys scan the cells of the table or report
+      TabularDataKey groupKey{key.reportName, key.reportForString, key.tableName, anyTabularDataString, anyTabularDataString, anyTabularDataString};
+      const TabularDataGroups& groups = (tableName ? m_tabularDataTables : m_tabularDataReports);
+      auto it = groups.find(groupKey);
+      if (it == groups.end()){
+        return nullptr;
+      }
+      for (size_t index : it->second){
+        const TabularDataCell& cell = m_tabularDataCells[index];
+        if ((!rowName || (cell.key.rowName == key.rowName)) &&
+            (!columnName || (cell.key.columnName == key.columnName)) &&
+            (!units || (cell.key.units == key.units)))
+        {
+          return &cell;
+        }
+      }
+      return nullptr;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                           const std::string& tableName, const std::string& rowName,
+                                                           const std::string& columnName, const std::string& units) const
+    {
+      const TabularDataCell* cell = tabularDataCell(reportName, reportForString, tableName, rowName, columnName, units);
+      if (cell){
+        return cell->doubleValue;
+      }
+      return boost::none;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                           const std::string& tableName, const std::string& rowName,
+                                                           const std::string& columnName) const
+    {
+      const TabularDataCell* cell = tabularDataCell(reportName, reportForString, tableName, rowName, columnName, boost::none);
+      if (cell){
+        return cell->doubleValue;
+      }
+      return boost::none;
+    }
+
+    boost::optional<std::string> SqlFile_Impl::tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                                 const std::string& tableName, const std::string& rowName,
+                                                                 const std::string& columnName, const std::string& units) const
+    {
+      const TabularDataCell* cell = tabularDataCell(reportName, reportForString, tableName, rowName, columnName, units);
+      if (cell){
+        return (cell->value == nullTabularDataString ? std::string() : m_tabularDataStrings[cell->value]);
+      }
+      return boost::none;
+    }
+
+    boost::optional<std::string> SqlFile_Impl::tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                                 const std::string& tableName, const std::string& rowName,
+                                                                 const std::string& columnName) const
+    {
+      const TabularDataCell* cell = tabularDataCell(reportName, reportForString, tableName, rowName, columnName, boost::none);
+      if (cell){
+        return (cell->value == nullTabularDataString ? std::string() : m_tabularDataStrings[cell->value]);
+      }
+      return boost::none;
+    }
+
+    boost::optional<std::string> SqlFile_Impl::tabularDataRowName(const std::string& reportName, const std::string& reportForString,
+                                                                  const std::string& tableName, const boost::optional<std::string>& columnName,
+                                                                  const std::string& value) const
+    {
+      loadTabularData();
+
+      boost::optional<unsigned> reportNameId = tabularDataStringId(reportName);
+      boost::optional<unsigned> reportForStringId = tabularDataStringId(reportForString);
+      boost::optional<unsigned> tableNameId = tabularDataStringId(tableName);
+      boost::optional<unsigned> valueId = tabularDataStringId(value);
+      boost::optional<unsigned> columnNameId = anyTabularDataString;
+      if (columnName){
+        columnNameId = tabularDataStringId(*columnName);
+      }
+      if (!reportNameId || !reportForStringId || !tableNameId || !valueId || !columnNameId){
+        return boost::none;
+      }
+
+      TabularDataKey key{*reportNameId, *reportForStringId, *tableNameId, *valueId, *columnNameId, anyTabularDataString};
+      auto it = m_tabularDataValueIndex.find(key);
+      if (it == m_tabularDataValueIndex.end()){
+        return boost::none;
+      }
+      return m_tabularDataStrings[m_tabularDataCells[it->second].key.rowName];
+    }
+
+    std::vector<std::string> SqlFile_Impl::tabularDataRowNames(const std::string& reportName, const std::string& reportForString,
+                                                               const std::string& tableName) const
+    {
+      std::vector<std::string> result;
+      const TabularDataCell* first = tabularDataCell(reportName, reportForString, tableName, boost::none, boost::none, boost::none);
+      if (!first){
+        return result;
+      }
+
+      TabularDataKey groupKey{first->key.reportName, first->key.reportForString, first->key.tableName, anyTabularDataString, anyTabularDataString, anyTabularDataString};
+      std::set<unsigned> found;
+      for (size_t index : m_tabularDataTables.find(groupKey)->second){
+        unsigned rowName = m_tabularDataCells[index].key.rowName;
+        if (found.insert(rowName).second){
+          result.push_back(m_tabularDataStrings[rowName]);
+        }
+      }
+      return result;
+    }
+
+    std::vector<std::string> SqlFile_Impl::tabularDataColumnNames(const std::string& reportName, const std::string& reportForString,
+                                                                  const std::string& tableName) const
+    {
+      std::vector<std::string> result;
+      const TabularDataCell* first = tabularDataCell(reportName, reportForString, tableName, boost::none, boost::none, boost::none);
+      if (!first){
+        return result;
+      }
+
+      TabularDataKey groupKey{first->key.reportName, first->key.reportForString, first->key.tableName, anyTabularDataString, anyTabularDataString, anyTabularDataString};
+      std::set<unsigned> found;
+      for (size_t index : m_tabularDataTables.find(groupKey)->second){
+        unsigned columnName = m_tabularDataCells[index].key.columnName;
+        if (found.insert(columnName).second){
+          result.push_back(m_tabularDataStrings[columnName]);
+        }
+      }
+      return result;
+    }
+
+    std::vector<std::vector<std::string> > SqlFile_Impl::tabularDataTable(const std::string& reportName, const std::string& reportForString,
+                                                                          const std::string& tableName) const
+    {
+      std::vector<std::vector<std::string> > result;
+      const TabularDataCell* first = tabularDataCell(reportName, reportForString, tableName, boost::none, boost::none, boost::none);
+      if (!first){
+        return result;
+      }
+
+      // rows and columns in order of first appearance, as tabularDataRowNames and tabularDataColumnNames
+      TabularDataKey groupKey{first->key.reportName, first->key.reportForString, first->key.tableName, anyTabularDataString, anyTabularDataString, anyTabularDataString};
+      const std::vector<size_t>& cells = m_tabularDataTables.find(groupKey)->second;
+      std::unordered_map<unsigned, size_t> rows;
+      std::unordered_map<unsigned, size_t> columns;
+      for (size_t index : cells){
+        const TabularDataCell& cell = m_tabularDataCells[index];
+        rows.emplace(cell.key.rowName, rows.size());
+        columns.emplace(cell.key.columnName, columns.size());
+      }
+
+      result.resize(rows.size(), std::vector<std::string>(columns.size()));
+      std::vector<std::vector<bool> > filled(rows.size(), std::vector<bool>(columns.size(), false));
+      for (size_t index : cells){
+        const TabularDataCell& cell = m_tabularDataCells[index];
+        size_t i = rows[cell.key.rowName];
+        size_t j = columns[cell.key.columnName];
+        if (!filled[i][j] && (cell.value != nullTabularDataString)){
+          result[i][j] = m_tabularDataStrings[cell.value];
+        }
+        filled[i][j] = true;
+      }
+      return result;
+    }
+
+    boost::optional<double> SqlFile_Impl::annualCost(const std::string& columnName) const
+    {
+      // depending on the EnergyPlus version the units are in the Units column or in the row name
+      boost::optional<double> result = tabularDataValue("Economics Results Summary Report", "Entire Facility", "Annual Cost", "Cost", columnName, "~~$~~");
+      if (!result){
+        result = tabularDataValue("Economics Results Summary Report", "Entire Facility", "Annual Cost", "Cost (~~$~~)", columnName);
+      }
+      return result;
+    }
+
     std::vector<double> SqlFile_Impl::timeSeriesValues(const DataDictionaryItem& dataDictionary)
     {
       std::vector<double> stdValues;
@@ -2338,32 +2669,9 @@ namespace openstudio{
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
       openstudio::OptionalTimeSeries ts;
-      std::string units = dataDictionary.units;
-
-      boost::optional<openstudio::DateTime> firstReportDateTime;
-      std::vector<long> stdSecondsFromFirstReport;
-      stdSecondsFromFirstReport.reserve(8760);
-
-      std::vector<double> stdValues;
-      stdValues.reserve(8760);
-      boost::optional<unsigned> reportingIntervalMinutes;
-
-      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-      bool isIntervalTimeSeries = false;
-      try {
-        reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
-                               (reportingFrequency == ReportingFrequency::Hourly) ||
-                               (reportingFrequency == ReportingFrequency::Daily);
-
-      }catch(const std::exception&){
-      }
 
       if (m_db) 
       {
-        std::string energyPlusVersion = this->energyPlusVersion();
-        VersionString version(energyPlusVersion);
-
         std::stringstream s;
         s << "SELECT dt.VariableValue, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Interval FROM ";
         s << dataDictionary.table;
@@ -2393,83 +2701,195 @@ namespace openstudio{
         s2 << code;
         LOG(Debug, s2.str());
 
-        long cumulativeSeconds = 0;
+        ts = timeSeries(dataDictionary, sqlStmtPtr, code, 0, [](){ return true; });
 
-        while (code == SQLITE_ROW) 
-        {
-          double value = sqlite3_column_double(sqlStmtPtr, 0);
-          stdValues.push_back(value);
-
-          unsigned month = sqlite3_column_int(sqlStmtPtr, 1);
-          unsigned day = sqlite3_column_int(sqlStmtPtr, 2);
-          unsigned intervalMinutes = sqlite3_column_int(sqlStmtPtr, 5); // used for run periods
-
-          if ((version.major() == 8) && (version.minor() == 3)){
-            // workaround for bug in E+ 8.3, issue #1692
-            if (reportingFrequency == ReportingFrequency::Daily){
-              intervalMinutes = 24 * 60;
-            } else if (reportingFrequency == ReportingFrequency::Monthly){
-              intervalMinutes = day * 24 * 60;
-            } else if (reportingFrequency == ReportingFrequency::RunPeriod){
-              DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-              DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-              Time deltaT = lastDateTime - firstDateTime;
-              intervalMinutes = deltaT.totalMinutes() + 60;
-            }
-          }
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(sqlStmtPtr);
+      }
 
-          if (!firstReportDateTime){
-            if ((month==0) || (day==0)){
-              // gets called for RunPeriod reports
-              firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-            } else{
-              // DLM: potential leap year problem
-              // DLM: get standard time zone?
-              if (intervalMinutes >= 24 * 60){
-                // Daily or Monthly
-                OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-                firstReportDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-              } else {
-                firstReportDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-              }
+      return ts;
+    }
 
-            }
+    openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary, sqlite3_stmt* sqlStmtPtr, int& code,
+                                                            int column, const std::function<bool ()>& rowInSeries)
+    {
+      openstudio::OptionalTimeSeries ts;
+      std::string energyPlusVersion = this->energyPlusVersion();
+      VersionString version(energyPlusVersion);
+
+      std::string units = dataDictionary.units;
+
+      boost::optional<openstudio::DateTime> firstReportDateTime;
+      std::vector<long> stdSecondsFromFirstReport;
+      stdSecondsFromFirstReport.reserve(8760);
+
+      std::vector<double> stdValues;
+      stdValues.reserve(8760);
+      boost::optional<unsigned> reportingIntervalMinutes;
+
+      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+      bool isIntervalTimeSeries = false;
+      try {
+        reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
+        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
+                               (reportingFrequency == ReportingFrequency::Hourly) ||
+                               (reportingFrequency == ReportingFrequency::Daily);
+
+      }catch(const std::exception&){
+      }
+
+      long cumulativeSeconds = 0;
+
+      while ((code == SQLITE_ROW) && rowInSeries()) 
+      {
+        double value = sqlite3_column_double(sqlStmtPtr, column);
+        stdValues.push_back(value);
+
+        unsigned month = sqlite3_column_int(sqlStmtPtr, column + 1);
+        unsigned day = sqlite3_column_int(sqlStmtPtr, column + 2);
+        unsigned intervalMinutes = sqlite3_column_int(sqlStmtPtr, column + 5); // used for run periods
+
+        if ((version.major() == 8) && (version.minor() == 3)){
+          // workaround for bug in E+ 8.3, issue #1692
+          if (reportingFrequency == ReportingFrequency::Daily){
+            intervalMinutes = 24 * 60;
+          } else if (reportingFrequency == ReportingFrequency::Monthly){
+            intervalMinutes = day * 24 * 60;
+          } else if (reportingFrequency == ReportingFrequency::RunPeriod){
+            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
+            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
+            Time deltaT = lastDateTime - firstDateTime;
+            intervalMinutes = deltaT.totalMinutes() + 60;
           }
+        }
 
-          // Use the new way to create the time series with nonzero first entry
-          cumulativeSeconds += 60*intervalMinutes;
-          stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+        if (!firstReportDateTime){
+          if ((month==0) || (day==0)){
+            // gets called for RunPeriod reports
+            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
+          } else{
+            // DLM: potential leap year problem
+            // DLM: get standard time zone?
+            if (intervalMinutes >= 24 * 60){
+              // Daily or Monthly
+              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+              firstReportDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
+            } else {
+              firstReportDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
+            }
 
-          // check if this interval is same as the others
-          if (isIntervalTimeSeries && !reportingIntervalMinutes){
-            reportingIntervalMinutes = intervalMinutes;
-          }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
-            isIntervalTimeSeries = false;
-            reportingIntervalMinutes.reset();
           }
+        }
 
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
+        // Use the new way to create the time series with nonzero first entry
+        cumulativeSeconds += 60*intervalMinutes;
+        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+
+        // check if this interval is same as the others
+        if (isIntervalTimeSeries && !reportingIntervalMinutes){
+          reportingIntervalMinutes = intervalMinutes;
+        }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
+          isIntervalTimeSeries = false;
+          reportingIntervalMinutes.reset();
         }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // step to next row
+        code = sqlite3_step(sqlStmtPtr);
+      }
 
-        if (firstReportDateTime && !stdSecondsFromFirstReport.empty()){
-          if (isIntervalTimeSeries){
-            openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-          }else{
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
-          }
+      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()){
+        if (isIntervalTimeSeries){
+          openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
+          openstudio::Vector values = createVector(stdValues);
+          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
+        }else{
+          openstudio::Vector values = createVector(stdValues);
+          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
         }
       }
 
       return ts;
     }
 
+    bool SqlFile_Impl::exportTimeSeries(const openstudio::path& path)
+    {
+      try {
+        TimeSeriesStoreWriter writer(path);
+
+        if (m_db) {
+          std::set<std::string> tables;
+          for (const DataDictionaryItem& item : m_dataDictionary){
+            tables.insert(item.table);
+          }
+
+          // one query per table, ordered so the rows of each series follow each other and only one
+          // series is held in memory at a time
+          for (const std::string& table : tables){
+            std::string indexColumn;
+            if (table == "ReportMeterData"){
+              indexColumn = "ReportMeterDataDictionaryIndex";
+            }else if (table == "ReportVariableData"){
+              indexColumn = "ReportVariableDataDictionaryIndex";
+            }else{
+              continue;
+            }
+
+            std::stringstream s;
+            s << "SELECT dt." << indexColumn << ", Time.EnvironmentPeriodIndex, ";
+            s << "dt.VariableValue, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Interval FROM ";
+            s << table;
+            s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
+            s << " ORDER BY dt." << indexColumn << ", Time.EnvironmentPeriodIndex, dt.TimeIndex";
+
+            sqlite3_stmt* sqlStmtPtr;
+            int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+            if (code != SQLITE_OK){
+              LOG(Error, "Could not export time series to '" << toString(path) << "': " << sqlite3_errmsg(m_db));
+              sqlite3_finalize(sqlStmtPtr);
+              return false;
+            }
+
+            bool ok = true;
+            code = sqlite3_step(sqlStmtPtr);
+            while (ok && (code == SQLITE_ROW)){
+              int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+              int envPeriodIndex = sqlite3_column_int(sqlStmtPtr, 1);
+              auto rowInSeries = [&](){
+                return (sqlite3_column_int(sqlStmtPtr, 0) == recordIndex) && (sqlite3_column_int(sqlStmtPtr, 1) == envPeriodIndex);
+              };
+
+              DataDictionaryTable::index<id>::type::iterator it = m_dataDictionary.get<id>().find(boost::make_tuple(recordIndex, envPeriodIndex));
+              if ((it == m_dataDictionary.get<id>().end()) || (it->table != table)){
+                // not in the data dictionary, skip the series
+                while ((code == SQLITE_ROW) && rowInSeries()){
+                  code = sqlite3_step(sqlStmtPtr);
+                }
+                continue;
+              }
+
+              openstudio::OptionalTimeSeries ts = timeSeries(*it, sqlStmtPtr, code, 2, rowInSeries);
+              if (ts && !writer.addTimeSeries(it->envPeriod, it->reportingFrequency, it->name, it->keyValue, *ts)){
+                LOG(Error, "Could not export time series '" << it->name << "' for '" << it->keyValue << "' to '" << toString(path) << "'");
+                ok = false;
+              }
+            }
+
+            // must finalize to prevent memory leaks
+            sqlite3_finalize(sqlStmtPtr);
+
+            if (!ok){
+              return false;
+            }
+          }
+        }
+
+        return writer.close();
+      } catch (const std::exception& e) {
+        LOG(Error, "Could not export time series to '" << toString(path) << "': " << e.what());
+      }
+      return false;
+    }
+
     openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary)
     {
       openstudio::DateTimeVector dateTimes;
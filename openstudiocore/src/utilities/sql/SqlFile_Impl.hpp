@@ -44,6 +44,9 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <functional>
 
 // forward declaration
 namespace resultsviewer{
@@ -68,7 +71,8 @@ namespace openstudio{
       /// or if file is not valid
       /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
       /// pass in false if those indexes are not needed
-      SqlFile_Impl(const openstudio::path& path, const bool createIndexes=true);
+      /// readOnly opens the file without write access, no indexes are created and the file is never modified
+      SqlFile_Impl(const openstudio::path& path, const bool createIndexes=true, const bool readOnly=false);
 
       /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
       /// pass in false if those indexes are not needed
@@ -87,6 +91,9 @@ namespace openstudio{
       /// returns whether or not connection is open
       bool connectionOpen() const;
 
+      /// returns whether or not the file was opened read only
+      bool isReadOnly() const;
+
       /// get the path
       openstudio::path path() const;
 
@@ -660,6 +667,9 @@ namespace openstudio{
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
       std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+      /// write all time series to a TimeSeriesStore
+      bool exportTimeSeries(const openstudio::path& path);
+
       // returns an optional pair of date times for begin and end of daylight savings time
       boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime> > daylightSavingsPeriod() const;
 
@@ -742,6 +752,43 @@ namespace openstudio{
       /// value(i,j) is the illuminance at x(i), y(j) - returns x, y and illuminance
       void illuminanceMap(const int& hourlyReportIndex, std::vector<double>& x, std::vector<double>& y, std::vector<double>& illuminance) const  ;
 
+      /// value of a tabular report cell as a double
+      boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                               const std::string& tableName, const std::string& rowName,
+                                               const std::string& columnName, const std::string& units) const;
+
+      /// value of a tabular report cell as a double, in any units
+      boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                               const std::string& tableName, const std::string& rowName,
+                                               const std::string& columnName) const;
+
+      /// value of a tabular report cell as a string
+      boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                     const std::string& tableName, const std::string& rowName,
+                                                     const std::string& columnName, const std::string& units) const;
+
+      /// value of a tabular report cell as a string, in any units
+      boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+                                                     const std::string& tableName, const std::string& rowName,
+                                                     const std::string& columnName) const;
+
+      /// name of the first row of a tabular report table with value in columnName, or in any column
+      boost::optional<std::string> tabularDataRowName(const std::string& reportName, const std::string& reportForString,
+                                                      const std::string& tableName, const boost::optional<std::string>& columnName,
+                                                      const std::string& value) const;
+
+      /// names of the rows of a tabular report table, in report order
+      std::vector<std::string> tabularDataRowNames(const std::string& reportName, const std::string& reportForString,
+                                                   const std::string& tableName) const;
+
+      /// names of the columns of a tabular report table, in report order
+      std::vector<std::string> tabularDataColumnNames(const std::string& reportName, const std::string& reportForString,
+                                                      const std::string& tableName) const;
+
+      /// values of a tabular report table, value(i,j) is at tabularDataRowNames()[i] and tabularDataColumnNames()[j]
+      std::vector<std::vector<std::string> > tabularDataTable(const std::string& reportName, const std::string& reportForString,
+                                                              const std::string& tableName) const;
+
       // execute a statement and return the first (if any) value as a double
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement) const;
 
@@ -812,6 +859,10 @@ namespace openstudio{
 
       // return a single timeseries matching recordIndex - internally used to retrieve timeseries
       boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
+      // build the time series from rows of value, month, day, hour, minute and interval starting at column,
+      // reads rows while code is SQLITE_ROW and rowInSeries() and leaves code at the first row not read
+      boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary, sqlite3_stmt* sqlStmtPtr, int& code,
+                                             int column, const std::function<bool ()>& rowInSeries);
       std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
       boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
@@ -828,10 +879,71 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // tabular report data, loaded from the TabularData and Strings tables on first use rather
+      // than querying the TabularDataWithStrings view for each value. all strings are interned,
+      // keys hold string ids.
+      struct TabularDataKey
+      {
+        unsigned reportName;
+        unsigned reportForString;
+        unsigned tableName;
+        unsigned rowName;
+        unsigned columnName;
+        unsigned units;
+
+        bool operator==(const TabularDataKey& other) const;
+      };
+
+      struct TabularDataKeyHash
+      {
+        size_t operator()(const TabularDataKey& key) const;
+      };
+
+      struct TabularDataCell
+      {
+        TabularDataKey key;
+        unsigned value;
+        double doubleValue;
+      };
+
+      typedef std::unordered_map<TabularDataKey, size_t, TabularDataKeyHash> TabularDataIndex;
+      typedef std::unordered_map<TabularDataKey, std::vector<size_t>, TabularDataKeyHash> TabularDataGroups;
+
+      void loadTabularData() const;
+
+      void clearTabularData();
+
+      unsigned internTabularDataString(const std::string& str) const;
+
+      boost::optional<unsigned> tabularDataStringId(const std::string& str) const;
+
+      // first cell matching all given fields, in TabularData order
+      const TabularDataCell* tabularDataCell(const std::string& reportName, const std::string& reportForString,
+                                             const boost::optional<std::string>& tableName, const boost::optional<std::string>& rowName,
+                                             const boost::optional<std::string>& columnName, const boost::optional<std::string>& units) const;
+
+      // annual cost from the Economics Results Summary Report
+      boost::optional<double> annualCost(const std::string& columnName) const;
+
+      // guards loading and clearing of the tabular data, which may be requested from several threads
+      mutable std::mutex m_tabularDataMutex;
+      mutable bool m_tabularDataLoaded;
+      mutable std::vector<std::string> m_tabularDataStrings;
+      mutable std::unordered_map<std::string, unsigned> m_tabularDataStringIds;
+      mutable std::vector<TabularDataCell> m_tabularDataCells;
+      // full key and key with any units to the first cell
+      mutable TabularDataIndex m_tabularDataCellIndex;
+      // (report, for, table, value in place of row, column or any column) to the first cell
+      mutable TabularDataIndex m_tabularDataValueIndex;
+      // (report, for, table) and (report, for) to all cells, in TabularData order
+      mutable TabularDataGroups m_tabularDataTables;
+      mutable TabularDataGroups m_tabularDataReports;
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
       openstudio::path m_path;
       bool m_connectionOpen;
+      bool m_readOnly;
       DataDictionaryTable m_dataDictionary;
       sqlite3* m_db;
       std::string m_sqliteFilename;
@@ -0,0 +1,95 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SqlFileFixture.hpp"
+
+#include "../SqlFileCollection.hpp"
+#include "../../data/EndUses.hpp"
+
+#include <cmath>
+
+using namespace openstudio;
+
+TEST_F(SqlFileFixture, SqlFileCollection)
+{
+  std::vector<openstudio::path> paths;
+  paths.push_back(sqlFile.path());
+  paths.push_back(sqlFile2.path());
+  paths.push_back(toPath("./NotAnSqlFile.sql"));
+  paths.push_back(sqlFile.path());
+
+  for (unsigned numThreads = 1; numThreads <= 4; ++numThreads){
+    SqlFileCollection collection(paths, numThreads);
+    EXPECT_EQ(numThreads, collection.numThreads());
+
+    Matrix summaryValues = collection.summaryValues();
+    ASSERT_EQ(paths.size(), summaryValues.size1());
+    ASSERT_EQ(SqlFileCollection::summaryValueNames().size(), summaryValues.size2());
+    EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), summaryValues(0, 0));
+    EXPECT_DOUBLE_EQ(*sqlFile.totalSiteEnergy(), summaryValues(0, 1));
+    EXPECT_DOUBLE_EQ(*sqlFile.netSourceEnergy(), summaryValues(0, 2));
+    EXPECT_DOUBLE_EQ(*sqlFile.totalSourceEnergy(), summaryValues(0, 3));
+    EXPECT_DOUBLE_EQ(*sqlFile2.netSiteEnergy(), summaryValues(1, 0));
+    for (unsigned j = 0; j < summaryValues.size2(); ++j){
+      EXPECT_TRUE(std::isnan(summaryValues(2, j)));
+      EXPECT_DOUBLE_EQ(summaryValues(0, j), summaryValues(3, j));
+    }
+
+    std::vector<SqlFileCollection::Metric> metrics;
+    metrics.push_back([](SqlFile& s) { return s.annualTotalUtilityCost(); });
+    metrics.push_back([](SqlFile& s) { return boost::optional<double>(); });
+    Matrix values = collection.evaluate(metrics);
+    ASSERT_EQ(paths.size(), values.size1());
+    ASSERT_EQ(2u, values.size2());
+    EXPECT_DOUBLE_EQ(*sqlFile2.annualTotalUtilityCost(), values(1, 0));
+    for (unsigned i = 0; i < values.size1(); ++i){
+      EXPECT_TRUE(std::isnan(values(i, 1)));
+    }
+  }
+
+  SqlFileCollection collection(paths);
+
+  Matrix endUseValues = collection.endUseValues();
+  std::vector<std::string> endUseValueNames = SqlFileCollection::endUseValueNames();
+  ASSERT_EQ(paths.size(), endUseValues.size1());
+  ASSERT_EQ(endUseValueNames.size(), endUseValues.size2());
+  boost::optional<EndUses> endUses = sqlFile.endUses();
+  ASSERT_TRUE(endUses);
+  EXPECT_EQ("Electricity:Heating", endUseValueNames[0]);
+  EXPECT_DOUBLE_EQ(endUses->getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::Heating), endUseValues(0, 0));
+
+  Matrix timeSeriesValues = collection.timeSeriesValues("", "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+  ASSERT_EQ(paths.size(), timeSeriesValues.size1());
+  ASSERT_EQ(8760u, timeSeriesValues.size2());
+  EXPECT_DOUBLE_EQ(-8.2625, timeSeriesValues(0, 0));
+  EXPECT_DOUBLE_EQ(-5.6875, timeSeriesValues(0, 8759));
+  EXPECT_TRUE(std::isnan(timeSeriesValues(2, 0)));
+  EXPECT_DOUBLE_EQ(-8.2625, timeSeriesValues(3, 0));
+}
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include "SqlFileFixture.hpp"
+#include "../TimeSeriesStore.hpp"
 
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
@@ -38,12 +39,14 @@
 #include "../../filetypes/EpwFile.hpp"
 #include "../../units/UnitFactory.hpp"
 #include "../../core/Application.hpp"
+#include "../../core/FilesystemHelpers.hpp"
 
 #include <QRegularExpression>
 
 #include <resources.hxx>
 
 #include <iostream>
+#include <algorithm>
 
 using namespace std;
 using namespace boost;
@@ -319,6 +322,133 @@ TEST_F(SqlFileFixture, AnnualTotalCosts) {
 
 }
 
+TEST_F(SqlFileFixture, TabularData)
+{
+  // values from the index match queries of the TabularDataWithStrings view
+  boost::optional<double> value = sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
+  ASSERT_TRUE(value);
+  boost::optional<double> queryValue = sqlFile.execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE ReportName='AnnualBuildingUtilityPerformanceSummary' AND ReportForString='Entire Facility' AND TableName='Site and Source Energy' AND RowName='Total Site Energy' AND ColumnName='Total Energy' AND Units='GJ'");
+  ASSERT_TRUE(queryValue);
+  EXPECT_DOUBLE_EQ(*queryValue, *value);
+  ASSERT_TRUE(sqlFile.totalSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.totalSiteEnergy(), *value);
+
+  // units may be left out
+  value = sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy");
+  ASSERT_TRUE(value);
+  EXPECT_DOUBLE_EQ(*queryValue, *value);
+
+  // names must match exactly
+  EXPECT_FALSE(sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "kWh"));
+  EXPECT_FALSE(sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "TOTAL SITE ENERGY", "Total Energy", "GJ"));
+  EXPECT_FALSE(sqlFile.tabularDataString("NotAReport", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy"));
+
+  // whole tables
+  std::vector<std::string> rowNames = sqlFile.tabularDataRowNames("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy");
+  std::vector<std::string> columnNames = sqlFile.tabularDataColumnNames("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy");
+  std::vector<std::vector<std::string> > table = sqlFile.tabularDataTable("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy");
+  ASSERT_FALSE(rowNames.empty());
+  ASSERT_FALSE(columnNames.empty());
+  ASSERT_EQ(rowNames.size(), table.size());
+  for (unsigned i = 0; i < rowNames.size(); ++i){
+    ASSERT_EQ(columnNames.size(), table[i].size());
+    for (unsigned j = 0; j < columnNames.size(); ++j){
+      boost::optional<std::string> cell = sqlFile.tabularDataString("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowNames[i], columnNames[j]);
+      ASSERT_TRUE(cell);
+      EXPECT_EQ(*cell, table[i][j]);
+    }
+  }
+  auto rowIt = std::find(rowNames.begin(), rowNames.end(), "Total Site Energy");
+  auto columnIt = std::find(columnNames.begin(), columnNames.end(), "Total Energy");
+  ASSERT_NE(rowNames.end(), rowIt);
+  ASSERT_NE(columnNames.end(), columnIt);
+  std::string cell = table[rowIt - rowNames.begin()][columnIt - columnNames.begin()];
+
+  // row lookup by value
+  boost::optional<std::string> rowName = sqlFile.tabularDataRowName("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", std::string("Total Energy"), cell);
+  ASSERT_TRUE(rowName);
+  EXPECT_EQ("Total Site Energy", *rowName);
+  EXPECT_FALSE(sqlFile.tabularDataRowName("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", boost::none, "not a value"));
+}
+
+TEST_F(SqlFileFixture, ReadOnly)
+{
+  openstudio::path path = sqlFile.path();
+  time_t lastWriteTime = openstudio::filesystem::last_write_time_as_time_t(path);
+
+  // any number of read only files may be open on the same path at once
+  SqlFile readOnly1(path, true, true);
+  SqlFile readOnly2(path, true, true);
+  ASSERT_TRUE(readOnly1.connectionOpen());
+  ASSERT_TRUE(readOnly2.connectionOpen());
+  EXPECT_TRUE(readOnly1.isReadOnly());
+  EXPECT_TRUE(readOnly2.isReadOnly());
+  EXPECT_FALSE(sqlFile.isReadOnly());
+
+  ASSERT_TRUE(readOnly1.totalSiteEnergy());
+  ASSERT_TRUE(readOnly2.totalSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.totalSiteEnergy(), *readOnly1.totalSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.totalSiteEnergy(), *readOnly2.totalSiteEnergy());
+  EXPECT_EQ(sqlFile.availableEnvPeriods(), readOnly1.availableEnvPeriods());
+  EXPECT_EQ(sqlFile.availableTimeSeries(), readOnly2.availableTimeSeries());
+
+  // the file is never written
+  readOnly1.createIndexes();
+  readOnly1.removeIndexes();
+  readOnly1.execute("CREATE TABLE ReadOnlyTest (Value INTEGER)");
+  EXPECT_FALSE(readOnly2.execAndReturnFirstInt("SELECT COUNT(*) FROM ReadOnlyTest"));
+  EXPECT_TRUE(readOnly1.close());
+  EXPECT_TRUE(readOnly2.close());
+  EXPECT_EQ(lastWriteTime, openstudio::filesystem::last_write_time_as_time_t(path));
+}
+
+TEST_F(SqlFileFixture, ExportTimeSeries)
+{
+  openstudio::path path = toPath("./SqlFileTimeSeriesStore.osts");
+  if (openstudio::filesystem::exists(path)){
+    openstudio::filesystem::remove(path);
+  }
+
+  ASSERT_TRUE(sqlFile.exportTimeSeries(path));
+  boost::optional<TimeSeriesStore> store = TimeSeriesStore::load(path);
+  ASSERT_TRUE(store);
+
+  std::vector<std::string> availableEnvPeriods = store->availableEnvPeriods();
+  ASSERT_EQ(sqlFile.availableEnvPeriods(), availableEnvPeriods);
+
+  // every series in the store matches the series in the sql file
+  unsigned numTimeSeries = 0;
+  for (const std::string& envPeriod : availableEnvPeriods){
+    for (const std::string& reportingFrequency : store->availableReportingFrequencies(envPeriod)){
+      for (const std::string& name : store->availableVariableNames(envPeriod, reportingFrequency)){
+        for (const std::string& keyValue : store->availableKeyValues(envPeriod, reportingFrequency, name)){
+          openstudio::OptionalTimeSeries expected = sqlFile.timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          openstudio::OptionalTimeSeries ts = store->timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          ASSERT_TRUE(expected);
+          ASSERT_TRUE(ts);
+          EXPECT_EQ(expected->units(), ts->units());
+          EXPECT_EQ(expected->firstReportDateTime(), ts->firstReportDateTime());
+          EXPECT_EQ(expected->secondsFromFirstReport(), ts->secondsFromFirstReport());
+          EXPECT_EQ(expected->intervalLength().is_initialized(), ts->intervalLength().is_initialized());
+          EXPECT_EQ(toStandardVector(expected->values()), toStandardVector(ts->values()));
+          ++numTimeSeries;
+        }
+      }
+    }
+  }
+  EXPECT_LT(0u, numTimeSeries);
+
+  openstudio::OptionalTimeSeries ts = store->timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+  ASSERT_TRUE(ts);
+  ASSERT_EQ(8760u, ts->values().size());
+  EXPECT_DOUBLE_EQ(-8.2625, ts->values()[0]);
+  EXPECT_DOUBLE_EQ(-5.6875, ts->values()[8759]);
+  EXPECT_FALSE(store->timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Not a key"));
+
+  // not a store
+  EXPECT_FALSE(TimeSeriesStore::load(sqlFile.path()));
+}
+
 void regressionTestSqlFile(const std::string& name, double netSiteEnergy, double firstVal, double lastVal)
 {
   openstudio::path fromPath = resourcesPath() / toPath("utilities/SqlFile") / toPath(name);
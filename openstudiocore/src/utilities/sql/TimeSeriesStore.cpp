@@ -0,0 +1,565 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "TimeSeriesStore.hpp"
+
+#include "../data/Vector.hpp"
+#include "../time/Date.hpp"
+#include "../time/DateTime.hpp"
+#include "../time/Time.hpp"
+
+#include <QFile>
+
+#include <zlib/zconf.h>
+#include <zlib/zlib.h>
+
+#include <cstring>
+#include <set>
+#include <sstream>
+
+namespace openstudio {
+
+namespace {
+
+  // file starts with the magic string, the format version, a marker to check byte order, and the offset of the dictionary
+  const char timeSeriesStoreMagic[8] = {'O', 'S', 'T', 'S', 'T', 'O', 'R', 'E'};
+  const uint32_t timeSeriesStoreVersion = 1;
+  const uint32_t timeSeriesStoreByteOrder = 0x01020304;
+  const std::streamoff timeSeriesStoreDictionaryOffsetPosition = 16;
+
+  template <typename T>
+  void writeValue(std::ostream& os, const T& value)
+  {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  bool readValue(std::istream& is, T& value)
+  {
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return is.good();
+  }
+
+  void writeString(std::ostream& os, const std::string& str)
+  {
+    writeValue(os, static_cast<uint32_t>(str.size()));
+    os.write(str.data(), str.size());
+  }
+
+  bool readString(std::istream& is, std::string& str)
+  {
+    uint32_t size = 0;
+    if (!readValue(is, size)){
+      return false;
+    }
+    str.resize(size);
+    if (size > 0){
+      is.read(&str[0], size);
+    }
+    return is.good();
+  }
+
+  // compress size bytes at data and append them to the stream, returns the compressed size or zero on failure
+  uint64_t writeCompressed(std::ostream& os, const void* data, size_t size)
+  {
+    if (size == 0){
+      return 0;
+    }
+    uLongf compressedSize = compressBound(static_cast<uLong>(size));
+    std::vector<Bytef> compressed(compressedSize);
+    if (compress2(compressed.data(), &compressedSize, static_cast<const Bytef*>(data), static_cast<uLong>(size), Z_BEST_SPEED) != Z_OK){
+      return 0;
+    }
+    os.write(reinterpret_cast<const char*>(compressed.data()), compressedSize);
+    return compressedSize;
+  }
+
+  // inflate compressedSize bytes at compressed into size bytes at data
+  bool uncompressBytes(const Bytef* compressed, uint64_t compressedSize, void* data, size_t size)
+  {
+    uLongf uncompressedSize = static_cast<uLongf>(size);
+    if (uncompress(static_cast<Bytef*>(data), &uncompressedSize, compressed, static_cast<uLong>(compressedSize)) != Z_OK){
+      return false;
+    }
+    return (uncompressedSize == size);
+  }
+
+  // read compressed bytes at offset into size bytes at data
+  bool readCompressed(std::istream& is, uint64_t offset, uint64_t compressedSize, void* data, size_t size)
+  {
+    if (size == 0){
+      return true;
+    }
+    std::vector<Bytef> compressed(static_cast<size_t>(compressedSize));
+    is.seekg(static_cast<std::streamoff>(offset));
+    is.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+    if (!is.good()){
+      return false;
+    }
+    return uncompressBytes(compressed.data(), compressed.size(), data, size);
+  }
+
+} // anonymous
+
+TimeSeriesStoreWriter::TimeSeriesStoreWriter(const openstudio::path& path)
+  : m_path(path), m_file(openstudio::toString(path).c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc), m_open(false)
+{
+  if (!m_file.good()){
+    LOG_AND_THROW("Cannot create time series store at '" << toString(m_path) << "'");
+  }
+
+  m_file.write(timeSeriesStoreMagic, sizeof(timeSeriesStoreMagic));
+  writeValue(m_file, timeSeriesStoreVersion);
+  writeValue(m_file, timeSeriesStoreByteOrder);
+  // dictionary offset is filled in by close
+  writeValue(m_file, static_cast<uint64_t>(0));
+  m_open = m_file.good();
+}
+
+TimeSeriesStoreWriter::~TimeSeriesStoreWriter()
+{
+  if (m_open){
+    close();
+  }
+}
+
+unsigned TimeSeriesStoreWriter::stringId(const std::string& str)
+{
+  auto it = m_stringIds.find(str);
+  if (it != m_stringIds.end()){
+    return it->second;
+  }
+  unsigned id = m_strings.size();
+  m_strings.push_back(str);
+  m_stringIds.insert(std::make_pair(str, id));
+  return id;
+}
+
+bool TimeSeriesStoreWriter::addTimeSeries(const std::string& envPeriod,
+                                          const std::string& reportingFrequency,
+                                          const std::string& timeSeriesName,
+                                          const std::string& keyValue,
+                                          const TimeSeries& timeSeries)
+{
+  if (!m_open){
+    LOG(Error, "Cannot add time series to closed time series store '" << toString(m_path) << "'");
+    return false;
+  }
+
+  std::tuple<unsigned, unsigned, unsigned, unsigned> key(stringId(envPeriod), stringId(reportingFrequency), stringId(timeSeriesName), stringId(keyValue));
+  if (m_columnIds.find(key) != m_columnIds.end()){
+    LOG(Warn, "Time series '" << timeSeriesName << "', '" << keyValue << "' already added to time series store '" << toString(m_path) << "'");
+    return false;
+  }
+
+  std::vector<double> values = toStandardVector(timeSeries.values());
+
+  // time index
+  detail::TimeSeriesStoreTimeIndex timeIndex;
+  DateTime firstReportDateTime = timeSeries.firstReportDateTime();
+  boost::optional<int> baseYear = firstReportDateTime.date().baseYear();
+  timeIndex.hasBaseYear = baseYear.is_initialized();
+  timeIndex.year = baseYear ? *baseYear : 0;
+  timeIndex.month = month(firstReportDateTime.date().monthOfYear());
+  timeIndex.day = firstReportDateTime.date().dayOfMonth();
+  timeIndex.seconds = firstReportDateTime.time().totalSeconds();
+  timeIndex.intervalSeconds = 0;
+  timeIndex.offset = 0;
+  timeIndex.size = 0;
+  timeIndex.count = 0;
+
+  std::vector<int64_t> seconds;
+  if (boost::optional<Time> intervalLength = timeSeries.intervalLength()){
+    timeIndex.intervalSeconds = intervalLength->totalSeconds();
+  } else {
+    std::vector<long> secondsFromStart = timeSeries.secondsFromStart();
+    if (secondsFromStart.empty() || (secondsFromStart[0] <= 0)){
+      // series that do not know the start of their first interval
+      secondsFromStart = timeSeries.secondsFromFirstReport();
+    }
+    seconds.assign(secondsFromStart.begin(), secondsFromStart.end());
+    timeIndex.count = seconds.size();
+  }
+
+  // series with the same time index share it
+  std::ostringstream keyStream;
+  writeValue(keyStream, timeIndex.hasBaseYear);
+  writeValue(keyStream, timeIndex.year);
+  writeValue(keyStream, timeIndex.month);
+  writeValue(keyStream, timeIndex.day);
+  writeValue(keyStream, timeIndex.seconds);
+  writeValue(keyStream, timeIndex.intervalSeconds);
+  if (!seconds.empty()){
+    keyStream.write(reinterpret_cast<const char*>(seconds.data()), seconds.size() * sizeof(int64_t));
+  }
+  std::string timeIndexKey = keyStream.str();
+
+  unsigned timeIndexId;
+  auto it = m_timeIndexIds.find(timeIndexKey);
+  if (it != m_timeIndexIds.end()){
+    timeIndexId = it->second;
+  } else {
+    timeIndex.offset = static_cast<uint64_t>(m_file.tellp());
+    timeIndex.size = writeCompressed(m_file, seconds.data(), seconds.size() * sizeof(int64_t));
+    timeIndexId = m_timeIndexes.size();
+    m_timeIndexes.push_back(timeIndex);
+    m_timeIndexIds.insert(std::make_pair(timeIndexKey, timeIndexId));
+  }
+
+  // values
+  detail::TimeSeriesStoreColumn column;
+  column.envPeriod = std::get<0>(key);
+  column.reportingFrequency = std::get<1>(key);
+  column.name = std::get<2>(key);
+  column.keyValue = std::get<3>(key);
+  column.units = stringId(timeSeries.units());
+  column.timeIndex = timeIndexId;
+  column.offset = static_cast<uint64_t>(m_file.tellp());
+  column.size = writeCompressed(m_file, values.data(), values.size() * sizeof(double));
+  column.count = values.size();
+
+  if (!m_file.good() || (!values.empty() && (column.size == 0))){
+    LOG(Error, "Cannot write time series '" << timeSeriesName << "', '" << keyValue << "' to time series store '" << toString(m_path) << "'");
+    return false;
+  }
+
+  m_columnIds.insert(std::make_pair(key, static_cast<unsigned>(m_columns.size())));
+  m_columns.push_back(column);
+
+  return true;
+}
+
+bool TimeSeriesStoreWriter::close()
+{
+  if (!m_open){
+    return false;
+  }
+  m_open = false;
+
+  uint64_t dictionaryOffset = static_cast<uint64_t>(m_file.tellp());
+
+  writeValue(m_file, static_cast<uint32_t>(m_strings.size()));
+  for (const std::string& str : m_strings){
+    writeString(m_file, str);
+  }
+
+  writeValue(m_file, static_cast<uint32_t>(m_timeIndexes.size()));
+  for (const detail::TimeSeriesStoreTimeIndex& timeIndex : m_timeIndexes){
+    writeValue(m_file, static_cast<uint8_t>(timeIndex.hasBaseYear ? 1 : 0));
+    writeValue(m_file, static_cast<int32_t>(timeIndex.year));
+    writeValue(m_file, static_cast<uint32_t>(timeIndex.month));
+    writeValue(m_file, static_cast<uint32_t>(timeIndex.day));
+    writeValue(m_file, static_cast<int32_t>(timeIndex.seconds));
+    writeValue(m_file, static_cast<int32_t>(timeIndex.intervalSeconds));
+    writeValue(m_file, timeIndex.offset);
+    writeValue(m_file, timeIndex.size);
+    writeValue(m_file, timeIndex.count);
+  }
+
+  writeValue(m_file, static_cast<uint32_t>(m_columns.size()));
+  for (const detail::TimeSeriesStoreColumn& column : m_columns){
+    writeValue(m_file, static_cast<uint32_t>(column.envPeriod));
+    writeValue(m_file, static_cast<uint32_t>(column.reportingFrequency));
+    writeValue(m_file, static_cast<uint32_t>(column.name));
+    writeValue(m_file, static_cast<uint32_t>(column.keyValue));
+    writeValue(m_file, static_cast<uint32_t>(column.units));
+    writeValue(m_file, static_cast<uint32_t>(column.timeIndex));
+    writeValue(m_file, column.offset);
+    writeValue(m_file, column.size);
+    writeValue(m_file, column.count);
+  }
+
+  m_file.seekp(timeSeriesStoreDictionaryOffsetPosition);
+  writeValue(m_file, dictionaryOffset);
+
+  bool result = m_file.good();
+  m_file.close();
+
+  if (!result){
+    LOG(Error, "Cannot write time series store '" << toString(m_path) << "'");
+  }
+
+  return result;
+}
+
+TimeSeriesStore::TimeSeriesStore(const openstudio::path& path)
+  : m_path(path), m_data(nullptr), m_size(0)
+{
+  std::ifstream file(openstudio::toString(m_path).c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!file.good()){
+    LOG_AND_THROW("Cannot open time series store '" << toString(m_path) << "'");
+  }
+
+  char magic[sizeof(timeSeriesStoreMagic)];
+  uint32_t version = 0;
+  uint32_t byteOrder = 0;
+  uint64_t dictionaryOffset = 0;
+  file.read(magic, sizeof(magic));
+  if (!file.good() || (std::memcmp(magic, timeSeriesStoreMagic, sizeof(magic)) != 0)){
+    LOG_AND_THROW("'" << toString(m_path) << "' is not a time series store");
+  }
+  if (!readValue(file, version) || (version != timeSeriesStoreVersion)){
+    LOG_AND_THROW("Unsupported version " << version << " of time series store '" << toString(m_path) << "'");
+  }
+  if (!readValue(file, byteOrder) || (byteOrder != timeSeriesStoreByteOrder)){
+    LOG_AND_THROW("Time series store '" << toString(m_path) << "' was written with a different byte order");
+  }
+  if (!readValue(file, dictionaryOffset) || (dictionaryOffset == 0)){
+    LOG_AND_THROW("Time series store '" << toString(m_path) << "' was not closed");
+  }
+
+  file.seekg(static_cast<std::streamoff>(dictionaryOffset));
+
+  bool ok = true;
+
+  uint32_t numStrings = 0;
+  ok = ok && readValue(file, numStrings);
+  for (uint32_t i = 0; ok && (i < numStrings); ++i){
+    std::string str;
+    ok = readString(file, str);
+    m_stringIds.insert(std::make_pair(str, static_cast<unsigned>(m_strings.size())));
+    m_strings.push_back(str);
+  }
+
+  uint32_t numTimeIndexes = 0;
+  ok = ok && readValue(file, numTimeIndexes);
+  for (uint32_t i = 0; ok && (i < numTimeIndexes); ++i){
+    uint8_t hasBaseYear = 0;
+    int32_t year = 0;
+    uint32_t month = 0;
+    uint32_t day = 0;
+    int32_t seconds = 0;
+    int32_t intervalSeconds = 0;
+    detail::TimeSeriesStoreTimeIndex timeIndex;
+    ok = readValue(file, hasBaseYear) && readValue(file, year) && readValue(file, month) && readValue(file, day) &&
+         readValue(file, seconds) && readValue(file, intervalSeconds) &&
+         readValue(file, timeIndex.offset) && readValue(file, timeIndex.size) && readValue(file, timeIndex.count);
+    timeIndex.hasBaseYear = (hasBaseYear != 0);
+    timeIndex.year = year;
+    timeIndex.month = month;
+    timeIndex.day = day;
+    timeIndex.seconds = seconds;
+    timeIndex.intervalSeconds = intervalSeconds;
+    m_timeIndexes.push_back(timeIndex);
+  }
+
+  uint32_t numColumns = 0;
+  ok = ok && readValue(file, numColumns);
+  for (uint32_t i = 0; ok && (i < numColumns); ++i){
+    uint32_t ids[6];
+    detail::TimeSeriesStoreColumn column;
+    ok = readValue(file, ids) && readValue(file, column.offset) && readValue(file, column.size) && readValue(file, column.count);
+    for (unsigned j = 0; ok && (j < 5); ++j){
+      ok = (ids[j] < m_strings.size());
+    }
+    ok = ok && (ids[5] < m_timeIndexes.size());
+    if (ok){
+      column.envPeriod = ids[0];
+      column.reportingFrequency = ids[1];
+      column.name = ids[2];
+      column.keyValue = ids[3];
+      column.units = ids[4];
+      column.timeIndex = ids[5];
+      m_columnIds.insert(std::make_pair(std::make_tuple(column.envPeriod, column.reportingFrequency, column.name, column.keyValue), static_cast<unsigned>(m_columns.size())));
+      m_columns.push_back(column);
+    }
+  }
+
+  if (!ok){
+    LOG_AND_THROW("Time series store '" << toString(m_path) << "' cannot be processed");
+  }
+
+  // map the file for the lifetime of the store, columns are inflated directly from the mapping
+  m_file = std::make_shared<QFile>(toQString(m_path));
+  if (m_file->open(QIODevice::ReadOnly)){
+    qint64 size = m_file->size();
+    if (size > 0){
+      m_data = m_file->map(0, size);
+      if (m_data){
+        m_size = static_cast<uint64_t>(size);
+      }
+    }
+  }
+  if (!m_data){
+    LOG(Debug, "Cannot map time series store '" << toString(m_path) << "', series will be read from the file");
+    m_file.reset();
+  }
+}
+
+boost::optional<TimeSeriesStore> TimeSeriesStore::load(const openstudio::path& path)
+{
+  boost::optional<TimeSeriesStore> result;
+  try {
+    result = TimeSeriesStore(path);
+  }catch(const std::exception&){
+  }
+  return result;
+}
+
+openstudio::path TimeSeriesStore::path() const
+{
+  return m_path;
+}
+
+bool TimeSeriesStore::readCompressed(uint64_t offset, uint64_t compressedSize, void* data, size_t size) const
+{
+  if (size == 0){
+    return true;
+  }
+  if (m_data){
+    if ((offset > m_size) || (compressedSize > m_size - offset)){
+      return false;
+    }
+    return uncompressBytes(m_data + offset, compressedSize, data, size);
+  }
+  std::ifstream file(openstudio::toString(m_path).c_str(), std::ios_base::in | std::ios_base::binary);
+  return openstudio::readCompressed(file, offset, compressedSize, data, size);
+}
+
+boost::optional<unsigned> TimeSeriesStore::stringId(const std::string& str) const
+{
+  auto it = m_stringIds.find(str);
+  if (it != m_stringIds.end()){
+    return it->second;
+  }
+  return boost::none;
+}
+
+std::vector<std::string> TimeSeriesStore::availableEnvPeriods() const
+{
+  std::vector<std::string> result;
+  std::set<unsigned> found;
+  for (const detail::TimeSeriesStoreColumn& column : m_columns){
+    if (found.insert(column.envPeriod).second){
+      result.push_back(m_strings[column.envPeriod]);
+    }
+  }
+  return result;
+}
+
+std::vector<std::string> TimeSeriesStore::availableReportingFrequencies(const std::string& envPeriod) const
+{
+  std::vector<std::string> result;
+  boost::optional<unsigned> envPeriodId = stringId(envPeriod);
+  if (!envPeriodId){
+    return result;
+  }
+  std::set<unsigned> found;
+  for (const detail::TimeSeriesStoreColumn& column : m_columns){
+    if ((column.envPeriod == *envPeriodId) && found.insert(column.reportingFrequency).second){
+      result.push_back(m_strings[column.reportingFrequency]);
+    }
+  }
+  return result;
+}
+
+std::vector<std::string> TimeSeriesStore::availableVariableNames(const std::string& envPeriod, const std::string& reportingFrequency) const
+{
+  std::vector<std::string> result;
+  boost::optional<unsigned> envPeriodId = stringId(envPeriod);
+  boost::optional<unsigned> reportingFrequencyId = stringId(reportingFrequency);
+  if (!envPeriodId || !reportingFrequencyId){
+    return result;
+  }
+  std::set<unsigned> found;
+  for (const detail::TimeSeriesStoreColumn& column : m_columns){
+    if ((column.envPeriod == *envPeriodId) && (column.reportingFrequency == *reportingFrequencyId) && found.insert(column.name).second){
+      result.push_back(m_strings[column.name]);
+    }
+  }
+  return result;
+}
+
+std::vector<std::string> TimeSeriesStore::availableKeyValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName) const
+{
+  std::vector<std::string> result;
+  boost::optional<unsigned> envPeriodId = stringId(envPeriod);
+  boost::optional<unsigned> reportingFrequencyId = stringId(reportingFrequency);
+  boost::optional<unsigned> nameId = stringId(timeSeriesName);
+  if (!envPeriodId || !reportingFrequencyId || !nameId){
+    return result;
+  }
+  for (const detail::TimeSeriesStoreColumn& column : m_columns){
+    if ((column.envPeriod == *envPeriodId) && (column.reportingFrequency == *reportingFrequencyId) && (column.name == *nameId)){
+      result.push_back(m_strings[column.keyValue]);
+    }
+  }
+  return result;
+}
+
+boost::optional<TimeSeries> TimeSeriesStore::timeSeries(const std::string& envPeriod,
+                                                        const std::string& reportingFrequency,
+                                                        const std::string& timeSeriesName,
+                                                        const std::string& keyValue) const
+{
+  boost::optional<TimeSeries> result;
+
+  boost::optional<unsigned> envPeriodId = stringId(envPeriod);
+  boost::optional<unsigned> reportingFrequencyId = stringId(reportingFrequency);
+  boost::optional<unsigned> nameId = stringId(timeSeriesName);
+  boost::optional<unsigned> keyValueId = stringId(keyValue);
+  if (!envPeriodId || !reportingFrequencyId || !nameId || !keyValueId){
+    return result;
+  }
+
+  auto it = m_columnIds.find(std::make_tuple(*envPeriodId, *reportingFrequencyId, *nameId, *keyValueId));
+  if (it == m_columnIds.end()){
+    return result;
+  }
+
+  const detail::TimeSeriesStoreColumn& column = m_columns[it->second];
+  const detail::TimeSeriesStoreTimeIndex& timeIndex = m_timeIndexes[column.timeIndex];
+
+  std::vector<double> values(static_cast<size_t>(column.count));
+  if (!readCompressed(column.offset, column.size, values.data(), values.size() * sizeof(double))){
+    LOG(Error, "Cannot read time series '" << timeSeriesName << "', '" << keyValue << "' from time series store '" << toString(m_path) << "'");
+    return result;
+  }
+
+  Date date = timeIndex.hasBaseYear ? Date(monthOfYear(timeIndex.month), timeIndex.day, timeIndex.year) : Date(monthOfYear(timeIndex.month), timeIndex.day);
+  DateTime firstReportDateTime(date, Time(0, 0, 0, timeIndex.seconds));
+
+  try {
+    if (timeIndex.intervalSeconds > 0){
+      result = TimeSeries(firstReportDateTime, Time(0, 0, 0, timeIndex.intervalSeconds), createVector(values), m_strings[column.units]);
+    } else {
+      std::vector<int64_t> seconds(static_cast<size_t>(timeIndex.count));
+      if (!readCompressed(timeIndex.offset, timeIndex.size, seconds.data(), seconds.size() * sizeof(int64_t))){
+        LOG(Error, "Cannot read time index of time series '" << timeSeriesName << "', '" << keyValue << "' from time series store '" << toString(m_path) << "'");
+        return result;
+      }
+      result = TimeSeries(firstReportDateTime, std::vector<long>(seconds.begin(), seconds.end()), createVector(values), m_strings[column.units]);
+    }
+  } catch (const std::exception& e) {
+    LOG(Error, "Cannot create time series '" << timeSeriesName << "', '" << keyValue << "' from time series store '" << toString(m_path) << "': " << e.what());
+  }
+
+  return result;
+}
+
+} // openstudio
@@ -0,0 +1,193 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_TIMESERIESSTORE_HPP
+#define UTILITIES_SQL_TIMESERIESSTORE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../data/TimeSeries.hpp"
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class QFile;
+
+namespace openstudio {
+
+namespace detail {
+
+  /// time index shared by the series of a TimeSeriesStore
+  struct TimeSeriesStoreTimeIndex
+  {
+    // first report date and time
+    bool hasBaseYear;
+    int year;
+    unsigned month;
+    unsigned day;
+    int seconds;
+    // interval length in seconds, zero if the series is not an interval series
+    int intervalSeconds;
+    // compressed seconds from start of each interval, empty for interval series
+    uint64_t offset;
+    uint64_t size;
+    uint64_t count;
+  };
+
+  /// column of values in a TimeSeriesStore
+  struct TimeSeriesStoreColumn
+  {
+    // ids of the envPeriod, reportingFrequency, name, keyValue and units strings
+    unsigned envPeriod;
+    unsigned reportingFrequency;
+    unsigned name;
+    unsigned keyValue;
+    unsigned units;
+    unsigned timeIndex;
+    // compressed values
+    uint64_t offset;
+    uint64_t size;
+    uint64_t count;
+  };
+
+} // detail
+
+/** TimeSeriesStoreWriter writes time series to a compact binary file that is read by TimeSeriesStore.
+ *  Each series is stored as a separately compressed column of values and series with the same time index
+ *  share one stored copy of it. The names and offsets of all columns are written at the end of the file
+ *  by close(), a single series can then be read without reading the rest of the file. */
+class UTILITIES_API TimeSeriesStoreWriter {
+ public:
+
+  /// constructor with path, will throw if the file cannot be created
+  explicit TimeSeriesStoreWriter(const openstudio::path& path);
+
+  /// closes the file if it is still open
+  ~TimeSeriesStoreWriter();
+
+  /// adds a time series, returns false if the same series has already been added or the file cannot be written
+  bool addTimeSeries(const std::string& envPeriod,
+                     const std::string& reportingFrequency,
+                     const std::string& timeSeriesName,
+                     const std::string& keyValue,
+                     const TimeSeries& timeSeries);
+
+  /// writes the names and offsets of all series and closes the file, returns false if the file cannot be written
+  bool close();
+
+ private:
+
+  TimeSeriesStoreWriter(const TimeSeriesStoreWriter& other);
+  TimeSeriesStoreWriter& operator=(const TimeSeriesStoreWriter& other);
+
+  unsigned stringId(const std::string& str);
+
+  openstudio::path m_path;
+  std::ofstream m_file;
+  bool m_open;
+  std::vector<std::string> m_strings;
+  std::map<std::string, unsigned> m_stringIds;
+  std::vector<detail::TimeSeriesStoreTimeIndex> m_timeIndexes;
+  std::map<std::string, unsigned> m_timeIndexIds;
+  std::vector<detail::TimeSeriesStoreColumn> m_columns;
+  std::map<std::tuple<unsigned, unsigned, unsigned, unsigned>, unsigned> m_columnIds;
+
+  REGISTER_LOGGER("openstudio.TimeSeriesStoreWriter");
+};
+
+/** TimeSeriesStore reads time series from a file written by TimeSeriesStoreWriter, e.g. by
+ *  SqlFile::exportTimeSeries. Only the names of the series are read on construction, the file is then
+ *  memory mapped for the lifetime of the store (shared by its copies) and the values of a series are
+ *  inflated from the mapping when it is requested. If the file cannot be mapped the series are read
+ *  from the file instead. */
+class UTILITIES_API TimeSeriesStore {
+ public:
+
+  /// constructor with path
+  /// will throw if path does not exist or file is incorrect
+  explicit TimeSeriesStore(const openstudio::path& path);
+
+  /// static load method
+  static boost::optional<TimeSeriesStore> load(const openstudio::path& path);
+
+  /// get the path
+  openstudio::path path() const;
+
+  /// returns the environment periods, in the order they were written
+  std::vector<std::string> availableEnvPeriods() const;
+
+  /// returns the reporting frequencies for the environment period
+  std::vector<std::string> availableReportingFrequencies(const std::string& envPeriod) const;
+
+  /// returns the names of the time series for the environment period and reporting frequency
+  std::vector<std::string> availableVariableNames(const std::string& envPeriod, const std::string& reportingFrequency) const;
+
+  /// returns the key values of the time series
+  std::vector<std::string> availableKeyValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName) const;
+
+  /// returns the time series matching envPeriod, reportingFrequency, timeSeriesName and keyValue
+  boost::optional<TimeSeries> timeSeries(const std::string& envPeriod,
+                                         const std::string& reportingFrequency,
+                                         const std::string& timeSeriesName,
+                                         const std::string& keyValue) const;
+
+ private:
+
+  boost::optional<unsigned> stringId(const std::string& str) const;
+
+  // inflate compressedSize bytes at offset in the file into size bytes at data
+  bool readCompressed(uint64_t offset, uint64_t compressedSize, void* data, size_t size) const;
+
+  openstudio::path m_path;
+  std::shared_ptr<QFile> m_file;
+  const unsigned char* m_data;
+  uint64_t m_size;
+  std::vector<std::string> m_strings;
+  std::map<std::string, unsigned> m_stringIds;
+  std::vector<detail::TimeSeriesStoreTimeIndex> m_timeIndexes;
+  std::vector<detail::TimeSeriesStoreColumn> m_columns;
+  std::map<std::tuple<unsigned, unsigned, unsigned, unsigned>, unsigned> m_columnIds;
+
+  REGISTER_LOGGER("openstudio.TimeSeriesStore");
+};
+
+// optional TimeSeriesStore
+typedef boost::optional<TimeSeriesStore> OptionalTimeSeriesStore;
+
+} // openstudio
+
+#endif // UTILITIES_SQL_TIMESERIESSTORE_HPP